@@ -6,6 +6,7 @@ import EditableCCodeBlock from "../../../../../common/EditableCCodeBlock";
 import withoutGeneric from "./topic13_files/without_generic.c?raw";
 import genericMax from "./topic13_files/generic_max.c?raw";
 import genericContainer from "./topic13_files/generic_container.c?raw";
+import typedVector from "./topic13_files/typed_vector.c?raw";
 
 const Topic13 = () => {
   const keyframes = `
@@ -99,6 +100,13 @@ const Topic13 = () => {
           <EditableCCodeBlock title="Generic dynamic array" initialCode={genericContainer} />
         </section>
 
+        {/* Example 4: Typed vector generated by a macro */}
+        <section className="space-y-4 animate-[fadeSlideUp_0.6s_ease-out_0.45s]">
+          <h2 className="text-2xl font-semibold border-l-4 border-indigo-500 pl-3">Example 4: Type-Specialized Vector with a Macro</h2>
+          <p>`VEC_DEFINE(T)` generates a dynamic array that stores elements by value – no `malloc` per element, contiguous iteration, and `push`, `append`, `pop`, `reserve`, `shrink_to_fit`.</p>
+          <EditableCCodeBlock title="VEC_DEFINE typed vector" initialCode={typedVector} />
+        </section>
+
         {/* Tips & Tricks */}
         <section className="space-y-4 animate-[fadeSlideUp_0.6s_ease-out_0.5s]">
           <h2 className="text-2xl font-semibold border-l-4 border-teal-500 pl-3">💎 Professional Tips & Tricks</h2>
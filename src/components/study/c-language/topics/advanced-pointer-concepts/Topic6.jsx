@@ -182,7 +182,7 @@ const Topic6 = () => {
             A callback is a function passed to another function. The standard library's <code>qsort</code> is a prime example: you provide a comparator function that <code>qsort</code> calls back to compare elements.
           </p>
           <EditableCCodeBlock
-            title="Example 3: Generic bubble sort with comparator callback"
+            title="Example 3: Generic sort (introsort) with comparator callback"
             initialCode={callbackExample}
           />
           <div className="bg-yellow-50 dark:bg-yellow-900/20 p-4 rounded-lg">
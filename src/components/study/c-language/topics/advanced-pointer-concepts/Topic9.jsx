@@ -80,7 +80,7 @@ const Topic9 = () => {
         <section className="space-y-4 animate-[fadeSlideUp_0.6s_ease-out_0.3s]">
           <h2 className="text-2xl font-semibold border-l-4 border-red-500 pl-3">Example 2: Generic Sort with Comparator</h2>
           <p>Recreating the `qsort` idea: a sort function that works on any array type by using a comparator function pointer.</p>
-          <EditableCCodeBlock title="Generic bubble sort with comparator" initialCode={genericSort} />
+          <EditableCCodeBlock title="Generic introsort with comparator" initialCode={genericSort} />
         </section>
 
         {/* Example 3: Event handling system */}
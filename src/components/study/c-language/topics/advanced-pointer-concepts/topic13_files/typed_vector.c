@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Type-specialized dynamic array generated by a macro.
+// VEC_DEFINE(T) writes a struct Vec_T and its functions for element type T.
+// Elements are stored contiguously *by value*: pushing an int copies the int
+// into the buffer, so there is no malloc per element, no pointer chasing on
+// access, and freeing the vector is a single free().
+
+#define VEC_DEFINE(T)                                                          \
+typedef struct {                                                               \
+    T *data;                                                                   \
+    size_t size;                                                               \
+    size_t capacity;                                                           \
+} Vec_##T;                                                                     \
+                                                                               \
+static inline void vec_##T##_init(Vec_##T *v) {                                \
+    v->data = NULL;                                                            \
+    v->size = v->capacity = 0;                                                 \
+}                                                                              \
+                                                                               \
+/* Make room for at least 'cap' elements; returns 0 on failure */              \
+static inline int vec_##T##_reserve(Vec_##T *v, size_t cap) {                  \
+    if (cap <= v->capacity) return 1;                                          \
+    T *tmp = realloc(v->data, cap * sizeof(T));                                \
+    if (!tmp) return 0;                                                        \
+    v->data = tmp;                                                             \
+    v->capacity = cap;                                                         \
+    return 1;                                                                  \
+}                                                                              \
+                                                                               \
+static inline int vec_##T##_grow_for(Vec_##T *v, size_t extra) {               \
+    size_t need = v->size + extra;                                             \
+    if (need <= v->capacity) return 1;                                         \
+    size_t cap = v->capacity ? v->capacity * 2 : 8;                            \
+    while (cap < need) cap *= 2;                                               \
+    return vec_##T##_reserve(v, cap);                                          \
+}                                                                              \
+                                                                               \
+static inline int vec_##T##_push(Vec_##T *v, T value) {                        \
+    if (v->size == v->capacity && !vec_##T##_grow_for(v, 1)) return 0;        \
+    v->data[v->size++] = value;                                                \
+    return 1;                                                                  \
+}                                                                              \
+                                                                               \
+/* Copy n elements in one go: at most one realloc, one memcpy */               \
+static inline int vec_##T##_append(Vec_##T *v, const T *src, size_t n) {       \
+    if (!vec_##T##_grow_for(v, n)) return 0;                                   \
+    memcpy(v->data + v->size, src, n * sizeof(T));                             \
+    v->size += n;                                                              \
+    return 1;                                                                  \
+}                                                                              \
+                                                                               \
+/* Remove the last element into *out; returns 0 if empty */                    \
+static inline int vec_##T##_pop(Vec_##T *v, T *out) {                         \
+    if (v->size == 0) return 0;                                                \
+    v->size--;                                                                 \
+    if (out) *out = v->data[v->size];                                          \
+    return 1;                                                                  \
+}                                                                              \
+                                                                               \
+static inline T* vec_##T##_at(Vec_##T *v, size_t i) {                         \
+    return i < v->size ? &v->data[i] : NULL;                                   \
+}                                                                              \
+                                                                               \
+/* Give back unused capacity */                                                \
+static inline void vec_##T##_shrink_to_fit(Vec_##T *v) {                      \
+    if (v->size == v->capacity) return;                                        \
+    if (v->size == 0) { free(v->data); v->data = NULL; v->capacity = 0; return; } \
+    T *tmp = realloc(v->data, v->size * sizeof(T));                            \
+    if (tmp) { v->data = tmp; v->capacity = v->size; }                         \
+}                                                                              \
+                                                                               \
+static inline void vec_##T##_free(Vec_##T *v) {                                \
+    free(v->data);                                                             \
+    vec_##T##_init(v);                                                         \
+}
+
+// Element types must be a single identifier (use a typedef for pointers etc.)
+typedef struct {
+    int roll;
+    char name[32];
+    float marks;
+} Student;
+
+VEC_DEFINE(int)
+VEC_DEFINE(double)
+VEC_DEFINE(Student)
+
+// Optional: one spelling for push that picks the right function by type (C11)
+#define vec_push(v, x) _Generic((v),          \
+    Vec_int*:     vec_int_push,               \
+    Vec_double*:  vec_double_push,            \
+    Vec_Student*: vec_Student_push)(v, x)
+
+int main() {
+    Vec_int nums;
+    vec_int_init(&nums);
+    vec_push(&nums, 42);
+    vec_push(&nums, 100);
+    int more[] = {7, 8, 9};
+    vec_int_append(&nums, more, 3);
+
+    for (size_t i = 0; i < nums.size; i++)
+        printf("nums[%zu] = %d\n", i, nums.data[i]);   // contiguous, no casts
+
+    int last;
+    if (vec_int_pop(&nums, &last))
+        printf("Popped %d, size now %zu, capacity %zu\n", last, nums.size, nums.capacity);
+    vec_int_shrink_to_fit(&nums);
+    printf("After shrink_to_fit: capacity %zu\n", nums.capacity);
+
+    // Structs are stored by value too
+    Vec_Student class;
+    vec_Student_init(&class);
+    vec_Student_reserve(&class, 3);                // one allocation up front
+    vec_push(&class, ((Student){1, "Asha", 88.5f}));
+    vec_push(&class, ((Student){2, "Ravi", 74.0f}));
+    vec_push(&class, ((Student){3, "Meera", 91.0f}));
+    for (size_t i = 0; i < class.size; i++) {
+        Student *s = vec_Student_at(&class, i);
+        printf("%d %-6s %.1f\n", s->roll, s->name, s->marks);
+    }
+
+    Vec_double avg;
+    vec_double_init(&avg);
+    double sum = 0;
+    for (size_t i = 0; i < class.size; i++) {
+        sum += class.data[i].marks;
+        vec_push(&avg, sum / (i + 1));
+    }
+    printf("Running averages: %.2f %.2f %.2f\n", avg.data[0], avg.data[1], avg.data[2]);
+
+    // One free per vector, not one per element
+    vec_int_free(&nums);
+    vec_Student_free(&class);
+    vec_double_free(&avg);
+    return 0;
+}
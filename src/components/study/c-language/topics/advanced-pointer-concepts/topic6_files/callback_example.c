@@ -3,21 +3,88 @@
 // Comparator callback type: returns negative if a<b, zero if equal, positive if a>b
 typedef int (*Compare)(int, int);
 
-// Generic sort that uses a callback for comparison
-void bubbleSort(int arr[], int n, Compare cmp) {
-    for (int i = 0; i < n-1; i++) {
-        for (int j = 0; j < n-i-1; j++) {
-            if (cmp(arr[j], arr[j+1]) > 0) {
-                int temp = arr[j];
-                arr[j] = arr[j+1];
-                arr[j+1] = temp;
-            }
+static void swapInts(int *a, int *b) {
+    int t = *a;
+    *a = *b;
+    *b = t;
+}
+
+static void insertionSort(int arr[], int n, Compare cmp) {
+    for (int i = 1; i < n; i++) {
+        int x = arr[i], j = i;
+        for (; j > 0 && cmp(x, arr[j-1]) < 0; j--) arr[j] = arr[j-1];
+        arr[j] = x;
+    }
+}
+
+static void siftDown(int arr[], int root, int n, Compare cmp) {
+    for (int child; (child = 2 * root + 1) < n; root = child) {
+        if (child + 1 < n && cmp(arr[child], arr[child+1]) < 0) child++;
+        if (cmp(arr[root], arr[child]) >= 0) return;
+        swapInts(&arr[root], &arr[child]);
+    }
+}
+
+static void heapSort(int arr[], int n, Compare cmp) {
+    for (int i = n / 2 - 1; i >= 0; i--) siftDown(arr, i, n, cmp);
+    for (int end = n - 1; end > 0; end--) {
+        swapInts(&arr[0], &arr[end]);
+        siftDown(arr, 0, end, cmp);
+    }
+}
+
+// Median of first, middle and last goes to arr[0] as the pivot; both
+// scans stop on equal elements so duplicates split evenly.
+// Returns the pivot's final position.
+static int partition(int arr[], int n, Compare cmp) {
+    int mid = n / 2;
+    if (cmp(arr[mid], arr[0]) < 0) swapInts(&arr[mid], &arr[0]);
+    if (cmp(arr[n-1], arr[mid]) < 0) {
+        swapInts(&arr[n-1], &arr[mid]);
+        if (cmp(arr[mid], arr[0]) < 0) swapInts(&arr[mid], &arr[0]);
+    }
+    swapInts(&arr[0], &arr[mid]);
+    int pivot = arr[0], i = 0, j = n;
+    for (;;) {
+        while (++i < n && cmp(arr[i], pivot) < 0) ;
+        while (cmp(pivot, arr[--j]) < 0) ;
+        if (i >= j) break;
+        swapInts(&arr[i], &arr[j]);
+    }
+    swapInts(&arr[0], &arr[j]);
+    return j;
+}
+
+static void introSort(int arr[], int n, int depth, Compare cmp) {
+    while (n > 16) {
+        if (depth-- == 0) {             // quicksort going badly: heapsort the rest
+            heapSort(arr, n, cmp);
+            return;
+        }
+        int p = partition(arr, n, cmp);
+        if (p < n - p - 1) {            // recurse on the smaller side
+            introSort(arr, p, depth, cmp);
+            arr += p + 1;
+            n -= p + 1;
+        } else {
+            introSort(arr + p + 1, n - p - 1, depth, cmp);
+            n = p;
         }
     }
+    insertionSort(arr, n, cmp);
 }
 
-int ascending(int a, int b) { return a - b; }
-int descending(int a, int b) { return b - a; }
+// Generic sort that uses a callback for comparison.
+// Introsort: quicksort, with heapsort once it recurses deeper than
+// 2*log2(n) and insertion sort for small pieces - O(n log n) always.
+void sortWith(int arr[], int n, Compare cmp) {
+    int depth = 0;
+    for (int m = n; m > 1; m >>= 1) depth += 2;
+    introSort(arr, n, depth, cmp);
+}
+
+int ascending(int a, int b) { return (a > b) - (a < b); }
+int descending(int a, int b) { return (a < b) - (a > b); }
 
 void printArray(int arr[], int n) {
     for (int i = 0; i < n; i++) printf("%d ", arr[i]);
@@ -27,12 +94,12 @@ void printArray(int arr[], int n) {
 int main() {
     int arr[] = {5, 2, 8, 1, 9};
     int n = sizeof(arr)/sizeof(arr[0]);
-    
-    bubbleSort(arr, n, ascending);
-    printArray(arr);   // 1 2 5 8 9
-    
-    bubbleSort(arr, n, descending);
-    printArray(arr);   // 9 8 5 2 1
-    
+
+    sortWith(arr, n, ascending);
+    printArray(arr, n);   // 1 2 5 8 9
+
+    sortWith(arr, n, descending);
+    printArray(arr, n);   // 9 8 5 2 1
+
     return 0;
-}
\ No newline at end of file
+}
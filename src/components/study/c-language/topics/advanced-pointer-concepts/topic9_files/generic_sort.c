@@ -1,47 +1,269 @@
+// Build: gcc -O2 generic_sort.c
+// Usage: ./a.out              demo below
+//        ./a.out --bench [n]  sort n ints (default 10^7) in several orders
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <time.h>
 
 // Comparator function pointer type
 typedef int (*Comparator)(const void*, const void*);
+// Same with a caller-supplied context, like qsort_r (argument order as in glibc)
+typedef int (*ComparatorCtx)(const void*, const void*, void*);
 
-// Generic bubble sort (works on any data type)
-void bubbleSort(void* base, size_t n, size_t size, Comparator cmp) {
-    for (size_t i = 0; i < n - 1; i++) {
-        for (size_t j = 0; j < n - i - 1; j++) {
-            char* a = (char*)base + j * size;
-            char* b = (char*)base + (j + 1) * size;
-            if (cmp(a, b) > 0) {
-                // swap a and b
-                char temp[size];
-                memcpy(temp, a, size);
-                memcpy(a, b, size);
-                memcpy(b, temp, size);
-            }
+// ---- swapping ----
+// The element size doesn't change during a sort, so the swap routine is
+// picked once: common sizes move as one or two integers, other multiples
+// of 8 word by word, anything else byte by byte. memcpy keeps unaligned
+// elements safe and compiles to plain loads and stores.
+typedef enum { SWAP_4, SWAP_8, SWAP_16, SWAP_WORDS, SWAP_BYTES } SwapKind;
+
+static SwapKind swapKindFor(size_t size) {
+    if (size == 4) return SWAP_4;
+    if (size == 8) return SWAP_8;
+    if (size == 16) return SWAP_16;
+    if (size % 8 == 0) return SWAP_WORDS;
+    return SWAP_BYTES;
+}
+
+static inline void swapElems(char *a, char *b, size_t size, SwapKind kind) {
+    switch (kind) {
+    case SWAP_4: {
+        uint32_t x, y;
+        memcpy(&x, a, 4); memcpy(&y, b, 4);
+        memcpy(a, &y, 4); memcpy(b, &x, 4);
+        break;
+    }
+    case SWAP_8: {
+        uint64_t x, y;
+        memcpy(&x, a, 8); memcpy(&y, b, 8);
+        memcpy(a, &y, 8); memcpy(b, &x, 8);
+        break;
+    }
+    case SWAP_16: {
+        uint64_t x[2], y[2];
+        memcpy(x, a, 16); memcpy(y, b, 16);
+        memcpy(a, y, 16); memcpy(b, x, 16);
+        break;
+    }
+    case SWAP_WORDS:
+        for (size_t i = 0; i < size; i += 8) {
+            uint64_t x, y;
+            memcpy(&x, a + i, 8); memcpy(&y, b + i, 8);
+            memcpy(a + i, &y, 8); memcpy(b + i, &x, 8);
+        }
+        break;
+    case SWAP_BYTES:
+        for (size_t i = 0; i < size; i++) {
+            char t = a[i];
+            a[i] = b[i];
+            b[i] = t;
+        }
+        break;
+    }
+}
+
+// ---- introsort ----
+#define INSERTION_THRESHOLD 16
+
+typedef struct {
+    size_t size;
+    SwapKind kind;
+    ComparatorCtx cmp;
+    void *ctx;
+} SortCall;
+
+#define ELEM(base, i) ((char*)(base) + (i) * c->size)
+#define LESS(x, y) (c->cmp((x), (y), c->ctx) < 0)
+
+static void insertionSort(char *base, size_t n, const SortCall *c) {
+    for (size_t i = 1; i < n; i++) {
+        for (size_t j = i; j > 0 && LESS(ELEM(base, j), ELEM(base, j - 1)); j--)
+            swapElems(ELEM(base, j), ELEM(base, j - 1), c->size, c->kind);
+    }
+}
+
+static void siftDown(char *base, size_t root, size_t n, const SortCall *c) {
+    for (;;) {
+        size_t child = 2 * root + 1;
+        if (child >= n) return;
+        if (child + 1 < n && LESS(ELEM(base, child), ELEM(base, child + 1))) child++;
+        if (!LESS(ELEM(base, root), ELEM(base, child))) return;
+        swapElems(ELEM(base, root), ELEM(base, child), c->size, c->kind);
+        root = child;
+    }
+}
+
+// O(n log n) no matter the input; used once quicksort has gone too deep
+static void heapSort(char *base, size_t n, const SortCall *c) {
+    for (size_t i = n / 2; i-- > 0; ) siftDown(base, i, n, c);
+    for (size_t end = n - 1; end > 0; end--) {
+        swapElems(ELEM(base, 0), ELEM(base, end), c->size, c->kind);
+        siftDown(base, 0, end, c);
+    }
+}
+
+static char* median3(char *a, char *b, char *d, const SortCall *c) {
+    if (LESS(a, b)) return LESS(b, d) ? b : (LESS(a, d) ? d : a);
+    return LESS(a, d) ? a : (LESS(b, d) ? d : b);
+}
+
+// Move a pivot to base[0] and return where it ends up after partitioning.
+// The pivot is the median of first, middle and last, or for larger ranges
+// the median of three such medians (Tukey's ninther), which keeps inputs
+// like organ pipes from degrading every level. Both scans stop on
+// elements equal to the pivot, so runs of equal keys split evenly
+// instead of going quadratic.
+static size_t partition(char *base, size_t n, const SortCall *c) {
+    char *lo = ELEM(base, 0), *mid = ELEM(base, n / 2), *hi = ELEM(base, n - 1);
+    if (n > 128) {
+        size_t step = n / 8;
+        lo = median3(lo, ELEM(base, step), ELEM(base, 2 * step), c);
+        mid = median3(ELEM(base, n / 2 - step), mid, ELEM(base, n / 2 + step), c);
+        hi = median3(ELEM(base, n - 1 - 2 * step), ELEM(base, n - 1 - step), hi, c);
+    }
+    char *pivot = median3(lo, mid, hi, c);
+    lo = ELEM(base, 0);
+    if (pivot != lo) swapElems(lo, pivot, c->size, c->kind);
+
+    size_t i = 0, j = n;
+    for (;;) {
+        while (++i < n && LESS(ELEM(base, i), lo)) ;
+        while (LESS(lo, ELEM(base, --j))) ;     // stops at base[0] at the latest
+        if (i >= j) break;
+        swapElems(ELEM(base, i), ELEM(base, j), c->size, c->kind);
+    }
+    swapElems(lo, ELEM(base, j), c->size, c->kind);
+    return j;
+}
+
+static void introSort(char *base, size_t n, int depth, const SortCall *c) {
+    while (n > INSERTION_THRESHOLD) {
+        if (depth-- == 0) {
+            heapSort(base, n, c);
+            return;
+        }
+        size_t p = partition(base, n, c);
+        // Recurse into the smaller side and loop on the larger one, so the
+        // stack never holds more than log2(n) frames
+        size_t left = p, right = n - p - 1;
+        if (left < right) {
+            introSort(base, left, depth, c);
+            base = ELEM(base, p + 1);
+            n = right;
+        } else {
+            introSort(ELEM(base, p + 1), right, depth, c);
+            n = left;
         }
     }
+    insertionSort(base, n, c);
+}
+
+#undef LESS
+#undef ELEM
+
+// Sort n elements of the given size with a context-taking comparator.
+// Introsort: median-of-three quicksort that switches to heapsort after
+// 2*log2(n) levels and to insertion sort below 16 elements. O(n log n)
+// worst case, no extra memory. Not stable.
+void genericSortCtx(void* base, size_t n, size_t size, ComparatorCtx cmp, void* ctx) {
+    if (n < 2 || size == 0) return;
+    int depth = 0;
+    for (size_t m = n; m > 1; m >>= 1) depth += 2;
+    SortCall c = { size, swapKindFor(size), cmp, ctx };
+    introSort(base, n, depth, &c);
+}
+
+static int callPlain(const void* a, const void* b, void* ctx) {
+    return (*(Comparator*)ctx)(a, b);
 }
 
+// Generic sort (works on any data type)
+void genericSort(void* base, size_t n, size_t size, Comparator cmp) {
+    genericSortCtx(base, n, size, callPlain, &cmp);
+}
+
+// Comparisons, not subtraction: ia - ib overflows for far-apart values
 int compareInt(const void* a, const void* b) {
     int ia = *(int*)a;
     int ib = *(int*)b;
-    return ia - ib;
+    return (ia > ib) - (ia < ib);
 }
 
 int compareIntDesc(const void* a, const void* b) {
     return compareInt(b, a);
 }
 
-int main() {
+// Context example: order indices by the values they point at
+int compareByKey(const void* a, const void* b, void* ctx) {
+    const int *keys = ctx;
+    return compareInt(&keys[*(const size_t*)a], &keys[*(const size_t*)b]);
+}
+
+static double nowSec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int runBench(size_t n) {
+    int *data = malloc(n * sizeof(int)), *copy = malloc(n * sizeof(int));
+    if (!data || !copy) {
+        printf("Out of memory!\n");
+        return 1;
+    }
+    const char *names[] = { "random", "sorted", "reversed", "all equal", "organ pipe", "few values" };
+    for (int pattern = 0; pattern < 6; pattern++) {
+        unsigned x = 12345;
+        for (size_t i = 0; i < n; i++) {
+            x = x * 1103515245u + 12345u;
+            switch (pattern) {
+            case 0: data[i] = (int)x; break;
+            case 1: data[i] = (int)i; break;
+            case 2: data[i] = (int)(n - i); break;
+            case 3: data[i] = 7; break;
+            case 4: data[i] = (int)(i < n / 2 ? i : n - i); break;
+            case 5: data[i] = (int)(x >> 16) % 4; break;
+            }
+        }
+        memcpy(copy, data, n * sizeof(int));
+        double t0 = nowSec();
+        genericSort(data, n, sizeof(int), compareInt);
+        double t1 = nowSec();
+        qsort(copy, n, sizeof(int), compareInt);
+        double t2 = nowSec();
+        int same = memcmp(data, copy, n * sizeof(int)) == 0;
+        printf("%-10s genericSort %.3f s, qsort %.3f s%s\n",
+               names[pattern], t1 - t0, t2 - t1, same ? "" : "  MISMATCH");
+    }
+    free(data);
+    free(copy);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        return runBench(argc > 2 ? strtoull(argv[2], NULL, 0) : 10000000);
+    }
+
     int arr[] = {5, 2, 9, 1, 7};
     size_t n = sizeof(arr)/sizeof(arr[0]);
-    
-    bubbleSort(arr, n, sizeof(int), compareInt);
+
+    genericSort(arr, n, sizeof(int), compareInt);
     for (size_t i = 0; i < n; i++) printf("%d ", arr[i]);
     printf("\n");
-    
-    bubbleSort(arr, n, sizeof(int), compareIntDesc);
+
+    genericSort(arr, n, sizeof(int), compareIntDesc);
     for (size_t i = 0; i < n; i++) printf("%d ", arr[i]);
     printf("\n");
-    
+
+    // Sort positions instead of the values themselves
+    int scores[] = {40, 10, 30, 20};
+    size_t order[] = {0, 1, 2, 3};
+    genericSortCtx(order, 4, sizeof(size_t), compareByKey, scores);
+    for (size_t i = 0; i < 4; i++) printf("scores[%zu]=%d ", order[i], scores[order[i]]);
+    printf("\n");
+
     return 0;
-}
\ No newline at end of file
+}
@@ -1,5 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#ifdef GUARDED_HEAP
+#include "../../dynamic-memory-allocation/topic17_files/guarded_heap.h"   // malloc/free go through the guarded heap
+#endif
 #include <string.h>
 
 // Manual debugging: simulate a simple "canary" to detect overflow
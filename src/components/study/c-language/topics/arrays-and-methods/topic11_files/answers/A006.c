@@ -1,13 +1,70 @@
 #include <stdio.h>
+#include <stdlib.h>
+
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
 
 int main() {
-    int n, arr[100], key, pos = -1;
+    int n = 0, key = 0, pos = -1;
     printf("Enter size: ");
-    scanf("%d", &n);
+    if(!readInt(&n)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Enter elements: ");
-    for(int i = 0; i < n; i++) scanf("%d", &arr[i]);
+    int *arr = readInts(&n);
     printf("Enter element to search: ");
-    scanf("%d", &key);
+    if(!readInt(&key)) {
+        printf("Invalid input.\n");
+        free(arr);
+        return 1;
+    }
     for(int i = 0; i < n; i++) {
         if(arr[i] == key) {
             pos = i;
@@ -18,5 +75,6 @@ int main() {
         printf("Element %d found at index %d\n", key, pos);
     else
         printf("Element not found\n");
+    free(arr);
     return 0;
 }
\ No newline at end of file
@@ -1,34 +1,168 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
+// Buffered output: numbers are formatted by hand into outBuf, and the
+// buffer leaves with a single write() when it fills or on flushOut(),
+// instead of one printf call (format parsing + stream lock) per number.
+static char outBuf[1 << 16];
+static size_t outLen;
+
+static void writeAll(const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t w = write(STDOUT_FILENO, p, len);
+        if (w <= 0) return;
+        p += w;
+        len -= (size_t)w;
+    }
+}
+
+// Text printed with printf is still in stdout's own buffer: it goes first
+static void flushOut(void) {
+    fflush(stdout);
+    writeAll(outBuf, outLen);
+    outLen = 0;
+}
+
+static void writeBytes(const char *s, size_t len) {
+    if (len > sizeof outBuf - outLen) {
+        flushOut();
+        if (len > sizeof outBuf) {
+            writeAll(s, len);
+            return;
+        }
+    }
+    memcpy(outBuf + outLen, s, len);
+    outLen += len;
+}
+
+static void writeChar(char c) {
+    if (outLen == sizeof outBuf) flushOut();
+    outBuf[outLen++] = c;
+}
+
+// "00" "01" ... "99": two digits per division by 100
+static const char DIGIT_PAIRS[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Formats v backwards so that it ends just before 'end'; returns its start
+static char* formatInt(char *end, int v) {
+    char *p = end;
+    unsigned u = v < 0 ? 0u - (unsigned)v : (unsigned)v;
+    while (u >= 100) {
+        unsigned r = u % 100;
+        u /= 100;
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * r, 2);
+    }
+    if (u >= 10) {
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * u, 2);
+    } else {
+        *--p = (char)('0' + u);
+    }
+    if (v < 0) *--p = '-';
+    return p;
+}
+
+static void writeInt(int v) {
+    char tmp[12];
+    char *p = formatInt(tmp + sizeof tmp, v);
+    writeBytes(p, (size_t)(tmp + sizeof tmp - p));
+}
 
 int main() {
-    int n1, n2, a[100], b[100];
+    int n1 = 0, n2 = 0;
     printf("Enter size of first sorted array: ");
-    scanf("%d", &n1);
+    if(!readInt(&n1)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Enter elements: ");
-    for(int i = 0; i < n1; i++) scanf("%d", &a[i]);
+    int *a = readInts(&n1);
     printf("Enter size of second sorted array: ");
-    scanf("%d", &n2);
+    if(!readInt(&n2)) {
+        printf("Invalid input.\n");
+        free(a);
+        return 1;
+    }
     printf("Enter elements: ");
-    for(int i = 0; i < n2; i++) scanf("%d", &b[i]);
+    int *b = readInts(&n2);
     // Union
     int i = 0, j = 0;
     printf("Union: ");
     while(i < n1 && j < n2) {
-        if(a[i] < b[j]) printf("%d ", a[i++]);
-        else if(b[j] < a[i]) printf("%d ", b[j++]);
-        else { printf("%d ", a[i]); i++; j++; }
+        if(a[i] < b[j]) { writeInt(a[i++]); writeChar(' '); }
+        else if(b[j] < a[i]) { writeInt(b[j++]); writeChar(' '); }
+        else { writeInt(a[i]); writeChar(' '); i++; j++; }
     }
-    while(i < n1) printf("%d ", a[i++]);
-    while(j < n2) printf("%d ", b[j++]);
-    printf("\n");
+    while(i < n1) { writeInt(a[i++]); writeChar(' '); }
+    while(j < n2) { writeInt(b[j++]); writeChar(' '); }
+    writeChar('\n');
+    flushOut();
     // Intersection
     i = 0; j = 0;
     printf("Intersection: ");
     while(i < n1 && j < n2) {
         if(a[i] < b[j]) i++;
         else if(b[j] < a[i]) j++;
-        else { printf("%d ", a[i]); i++; j++; }
+        else { writeInt(a[i]); writeChar(' '); i++; j++; }
     }
-    printf("\n");
+    writeChar('\n');
+    flushOut();
+    free(a);
+    free(b);
     return 0;
 }
\ No newline at end of file
@@ -1,21 +1,180 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
+
+// Read an r x c matrix into one heap block. Use it through a pointer to
+// a row so m[i][j] still works: int (*m)[c] = readMatrix(r, c);
+// Returns NULL unless r and c are positive, r*c is at most 2^30 and all
+// r*c numbers arrive.
+static void* readMatrix(int r, int c) {
+    if (r <= 0 || c <= 0 || r > (1 << 30) / c) return NULL;
+    int count = r * c;
+    int *m = readInts(&count);
+    if (m && count < r * c) {
+        free(m);
+        return NULL;
+    }
+    return m;
+}
+
+// Buffered output: numbers are formatted by hand into outBuf, and the
+// buffer leaves with a single write() when it fills or on flushOut(),
+// instead of one printf call (format parsing + stream lock) per number.
+static char outBuf[1 << 16];
+static size_t outLen;
+
+static void writeAll(const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t w = write(STDOUT_FILENO, p, len);
+        if (w <= 0) return;
+        p += w;
+        len -= (size_t)w;
+    }
+}
+
+// Text printed with printf is still in stdout's own buffer: it goes first
+static void flushOut(void) {
+    fflush(stdout);
+    writeAll(outBuf, outLen);
+    outLen = 0;
+}
+
+static void writeBytes(const char *s, size_t len) {
+    if (len > sizeof outBuf - outLen) {
+        flushOut();
+        if (len > sizeof outBuf) {
+            writeAll(s, len);
+            return;
+        }
+    }
+    memcpy(outBuf + outLen, s, len);
+    outLen += len;
+}
+
+static void writeChar(char c) {
+    if (outLen == sizeof outBuf) flushOut();
+    outBuf[outLen++] = c;
+}
+
+// "00" "01" ... "99": two digits per division by 100
+static const char DIGIT_PAIRS[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Formats v backwards so that it ends just before 'end'; returns its start
+static char* formatInt(char *end, int v) {
+    char *p = end;
+    unsigned u = v < 0 ? 0u - (unsigned)v : (unsigned)v;
+    while (u >= 100) {
+        unsigned r = u % 100;
+        u /= 100;
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * r, 2);
+    }
+    if (u >= 10) {
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * u, 2);
+    } else {
+        *--p = (char)('0' + u);
+    }
+    if (v < 0) *--p = '-';
+    return p;
+}
+
+static void writeInt(int v) {
+    char tmp[12];
+    char *p = formatInt(tmp + sizeof tmp, v);
+    writeBytes(p, (size_t)(tmp + sizeof tmp - p));
+}
 
 int main() {
-    int a[10][10], trans[10][10], r, c;
+    int r = 0, c = 0;
     printf("Enter rows and cols: ");
-    scanf("%d %d", &r, &c);
+    if(!readInt(&r) || !readInt(&c)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Enter matrix:\n");
-    for(int i = 0; i < r; i++)
-        for(int j = 0; j < c; j++)
-            scanf("%d", &a[i][j]);
+    if(r <= 0 || c <= 0) {
+        printf("Invalid size.\n");
+        return 1;
+    }
+    int (*a)[c] = readMatrix(r, c);
+    if(!a) {
+        printf("Not enough input.\n");
+        return 1;
+    }
+    int (*trans)[r] = malloc(c * sizeof *trans);
+    if(!trans) {
+        printf("Memory allocation failed\n");
+        free(a);
+        return 1;
+    }
     for(int i = 0; i < r; i++)
         for(int j = 0; j < c; j++)
             trans[j][i] = a[i][j];
     printf("Transpose:\n");
     for(int i = 0; i < c; i++) {
-        for(int j = 0; j < r; j++)
-            printf("%d ", trans[i][j]);
-        printf("\n");
+        for(int j = 0; j < r; j++) {
+            writeInt(trans[i][j]);
+            writeChar(' ');
+        }
+        writeChar('\n');
     }
+    flushOut();
+    free(a);
+    free(trans);
     return 0;
 }
\ No newline at end of file
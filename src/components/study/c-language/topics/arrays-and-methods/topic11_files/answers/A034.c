@@ -1,13 +1,88 @@
 #include <stdio.h>
+#include <stdlib.h>
+
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
+
+// Read an r x c matrix into one heap block. Use it through a pointer to
+// a row so m[i][j] still works: int (*m)[c] = readMatrix(r, c);
+// Returns NULL unless r and c are positive, r*c is at most 2^30 and all
+// r*c numbers arrive.
+static void* readMatrix(int r, int c) {
+    if (r <= 0 || c <= 0 || r > (1 << 30) / c) return NULL;
+    int count = r * c;
+    int *m = readInts(&count);
+    if (m && count < r * c) {
+        free(m);
+        return NULL;
+    }
+    return m;
+}
 
 int main() {
-    int a[10][10], n, sym = 1;
+    int n = 0, sym = 1;
     printf("Enter order of matrix: ");
-    scanf("%d", &n);
+    if(!readInt(&n)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Enter matrix:\n");
-    for(int i = 0; i < n; i++)
-        for(int j = 0; j < n; j++)
-            scanf("%d", &a[i][j]);
+    if(n <= 0) {
+        printf("Invalid size.\n");
+        return 1;
+    }
+    int (*a)[n] = readMatrix(n, n);
+    if(!a) {
+        printf("Not enough input.\n");
+        return 1;
+    }
     for(int i = 0; i < n && sym; i++) {
         for(int j = 0; j < n; j++) {
             if(a[i][j] != a[j][i]) {
@@ -18,5 +93,6 @@ int main() {
     }
     if(sym) printf("Matrix is symmetric.\n");
     else printf("Matrix is not symmetric.\n");
+    free(a);
     return 0;
 }
\ No newline at end of file
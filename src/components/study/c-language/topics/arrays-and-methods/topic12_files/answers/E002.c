@@ -1,84 +1,260 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 /*
-    Function: merge
-    ----------------
-    This function merges two sorted subarrays into one sorted array.
+    Bottom-up natural merge sort
+    ----------------------------
+    Instead of splitting the array in halves recursively, we look for
+    the pieces that are already sorted ("runs"), make every run at least
+    MIN_RUN long with insertion sort, and then merge neighbouring runs
+    pass after pass until one run is left.
+
+    - Already sorted (or reversed) input is one run: a single scan.
+    - All merges share one scratch buffer of n/2 elements, allocated once.
+    - The sort is stable: equal values keep their order.
+*/
+#define MIN_RUN 32
+
+/*
+    Function: binaryInsertionSort
+    ------------------------------
+    Sorts arr[lo ... hi-1] when arr[lo ... start-1] is already sorted.
+
+    Each new element is placed with a binary search. It goes after any
+    equal elements, which keeps the sort stable.
+*/
+void binaryInsertionSort(int arr[], int lo, int start, int hi) {
+
+    for (int i = start; i < hi; i++) {
+
+        int x = arr[i];
+        int left = lo, right = i;
+
+        // Find the first element greater than x
+        while (left < right) {
+            int mid = left + (right - left) / 2;
+            if (x < arr[mid])
+                right = mid;
+            else
+                left = mid + 1;
+        }
+
+        // Shift the bigger elements one place right and insert x
+        memmove(&arr[left + 1], &arr[left], (i - left) * sizeof(int));
+        arr[left] = x;
+    }
+}
+
+/*
+    Function: countRun
+    -------------------
+    Returns the length of the run that starts at index lo.
+
+    A run is either non-descending (1 2 2 5) or strictly descending
+    (9 7 4). A descending run is reversed so that every run ends up
+    ascending. Only strictly descending runs are reversed, so equal
+    values never swap places.
+*/
+int countRun(int arr[], int lo, int hi) {
+
+    int end = lo + 1;
+    if (end == hi)
+        return 1;
 
-    Parameters:
-    arr[] → Original array
-    l     → Left index
-    m     → Middle index
-    r     → Right index
+    if (arr[end] < arr[lo]) {
+
+        while (end + 1 < hi && arr[end + 1] < arr[end])
+            end++;
+
+        // Reverse arr[lo ... end]
+        for (int i = lo, j = end; i < j; i++, j--) {
+            int temp = arr[i];
+            arr[i] = arr[j];
+            arr[j] = temp;
+        }
+    } else {
+
+        while (end + 1 < hi && arr[end + 1] >= arr[end])
+            end++;
+    }
 
-    The subarrays are:
-    Left  part → arr[l ... m]
-    Right part → arr[m+1 ... r]
+    return end - lo + 1;
+}
+
+/*
+    Function: gallopRight
+    ----------------------
+    Returns the first index in arr[lo ... hi-1] whose value is > key.
+
+    "Galloping": check 1, 3, 7, 15, ... elements from the left end, then
+    binary search the last gap. This is very fast when the answer is
+    close to lo, which is common for partly sorted data.
 */
-void merge(int arr[], int l, int m, int r) {
+int gallopRight(int key, int arr[], int lo, int hi) {
+
+    int prev = lo, step = 1;
+
+    while (lo + step - 1 < hi && arr[lo + step - 1] <= key) {
+        prev = lo + step;
+        step *= 2;
+    }
 
-    int n1 = m - l + 1;   // Size of left subarray
-    int n2 = r - m;       // Size of right subarray
+    int right = (lo + step - 1 < hi) ? lo + step - 1 : hi;
 
-    int L[n1], R[n2];     // Temporary arrays
+    while (prev < right) {
+        int mid = prev + (right - prev) / 2;
+        if (arr[mid] <= key)
+            prev = mid + 1;
+        else
+            right = mid;
+    }
+    return prev;
+}
 
-    // Copy data into temporary left array
-    for (int i = 0; i < n1; i++)
-        L[i] = arr[l + i];
+/*
+    Function: gallopLeftFromEnd
+    ----------------------------
+    Returns the first index in arr[lo ... hi-1] whose value is >= key,
+    galloping from the right end instead.
+*/
+int gallopLeftFromEnd(int key, int arr[], int lo, int hi) {
 
-    // Copy data into temporary right array
-    for (int j = 0; j < n2; j++)
-        R[j] = arr[m + 1 + j];
+    int next = hi, step = 1;
 
-    int i = 0, j = 0;     // Initial indexes of subarrays
-    int k = l;            // Initial index of merged array
+    while (hi - step >= lo && arr[hi - step] >= key) {
+        next = hi - step;
+        step *= 2;
+    }
 
-    /*
-        Compare elements from both arrays
-        and copy the smaller one into original array
-    */
-    while (i < n1 && j < n2) {
+    int left = (hi - step >= lo) ? hi - step + 1 : lo;
 
-        if (L[i] <= R[j])
-            arr[k++] = L[i++];   // Copy from left
+    while (left < next) {
+        int mid = left + (next - left) / 2;
+        if (arr[mid] >= key)
+            next = mid;
         else
-            arr[k++] = R[j++];   // Copy from right
+            left = mid + 1;
     }
+    return next;
+}
+
+/*
+    Function: merge
+    ----------------
+    Merges two sorted runs that sit next to each other:
+
+    Left  run → arr[lo ... mid-1]
+    Right run → arr[mid ... hi-1]
+
+    buf → scratch space of at least n/2 elements
+
+    Elements at the start of the left run that are <= the whole right
+    run, and elements at the end of the right run that are >= the whole
+    left run, are already in their final place. Galloping finds them,
+    and only what is left in between is merged. The smaller of the two
+    remaining parts is copied into buf, so buf never needs more than
+    n/2 elements.
+*/
+void merge(int arr[], int lo, int mid, int hi, int buf[]) {
 
-    /*
-        Copy remaining elements (if any)
-        Only one of these loops will execute
-    */
-    while (i < n1)
-        arr[k++] = L[i++];
+    // The two runs are already in order: nothing to do
+    if (arr[mid - 1] <= arr[mid])
+        return;
 
-    while (j < n2)
-        arr[k++] = R[j++];
+    lo = gallopRight(arr[mid], arr, lo, mid);
+    hi = gallopLeftFromEnd(arr[mid - 1], arr, mid, hi);
+
+    int n1 = mid - lo;    // Size of left part
+    int n2 = hi - mid;    // Size of right part
+
+    if (n1 <= n2) {
+
+        // Copy the left part out and merge from the front
+        memcpy(buf, &arr[lo], n1 * sizeof(int));
+
+        int i = 0, j = mid, k = lo;
+        while (i < n1 && j < hi) {
+            if (arr[j] < buf[i])
+                arr[k++] = arr[j++];   // Copy from right
+            else
+                arr[k++] = buf[i++];   // Copy from left (wins ties)
+        }
+        while (i < n1)
+            arr[k++] = buf[i++];
+    } else {
+
+        // Copy the right part out and merge from the back
+        memcpy(buf, &arr[mid], n2 * sizeof(int));
+
+        int i = mid - 1, j = n2 - 1, k = hi - 1;
+        while (i >= lo && j >= 0) {
+            if (buf[j] < arr[i])
+                arr[k--] = arr[i--];   // Copy from left
+            else
+                arr[k--] = buf[j--];   // Copy from right (wins ties at the back)
+        }
+        while (j >= 0)
+            arr[k--] = buf[j--];
+    }
 }
 
 /*
     Function: mergeSort
     ---------------------
-    Recursive function that divides the array into halves
-    until single elements remain, then merges them back.
+    Sorts arr[l ... r].
+
+    1. Split the array into runs of at least MIN_RUN elements
+    2. Merge runs 0+1, 2+3, 4+5, ... then repeat with the merged runs
+       until only one run is left
 */
 void mergeSort(int arr[], int l, int r) {
 
-    // Base condition: At least two elements
-    if (l < r) {
+    arr += l;
+    int n = r - l + 1;
+    if (n < 2)
+        return;
 
-        // Find middle index
-        int m = l + (r - l) / 2;
+    // One allocation: the n/2 merge buffer followed by the run starts
+    int *buf = malloc((n / 2 + 1 + n / MIN_RUN + 2) * sizeof(int));
+    if (buf == NULL) {
+        binaryInsertionSort(arr, 0, 1, n);
+        return;
+    }
+    int *runs = buf + n / 2 + 1;
+    int count = 0;
+
+    // Step 1: find the runs
+    for (int lo = 0; lo < n; ) {
 
-        // Recursively sort left half
-        mergeSort(arr, l, m);
+        int len = countRun(arr, lo, n);
 
-        // Recursively sort right half
-        mergeSort(arr, m + 1, r);
+        // Too short: extend it with insertion sort
+        if (len < MIN_RUN) {
+            int end = (lo + MIN_RUN < n) ? lo + MIN_RUN : n;
+            binaryInsertionSort(arr, lo, lo + len, end);
+            len = end - lo;
+        }
 
-        // Merge the two sorted halves
-        merge(arr, l, m, r);
+        runs[count++] = lo;
+        lo += len;
     }
+    runs[count] = n;      // End marker
+
+    // Step 2: merge neighbouring runs until one is left
+    while (count > 1) {
+
+        int kept = 0;
+        for (int i = 0; i < count; i += 2) {
+            if (i + 1 < count)
+                merge(arr, runs[i], runs[i + 1], runs[i + 2], buf);
+            runs[kept++] = runs[i];
+        }
+        runs[kept] = n;
+        count = kept;
+    }
+
+    free(buf);
 }
 
 /*
@@ -91,11 +267,15 @@ void mergeSort(int arr[], int l, int r) {
 */
 int main() {
 
-    int n, arr[100];
+    int n;
 
     printf("Enter size: ");
     scanf("%d", &n);
 
+    int *arr = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (arr == NULL)
+        return 1;
+
     printf("Enter elements: ");
     for (int i = 0; i < n; i++)
         scanf("%d", &arr[i]);
@@ -110,5 +290,6 @@ int main() {
 
     printf("\n");
 
+    free(arr);
     return 0;
 }
@@ -1,109 +1,322 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 
 /*
-    Function: getMax
-    -----------------
-    Finds the maximum element in the array.
-    This helps determine the number of digits
-    in the largest number.
+    Radix sort on bytes (LSD: least significant digit first)
+    ----------------------------------------------------------
+    Instead of decimal digits (up to 10 passes for an int, each with
+    its own temporary array) the key is cut into bytes: "digits" in
+    base 256. A 32-bit key always needs at most 4 passes, a 64-bit
+    key at most 8.
+
+    - The counts for every byte position are taken in ONE read of the
+      keys, before the first pass.
+    - A pass is skipped when all keys have the same byte there
+      (e.g. the top bytes of small numbers): it would move nothing.
+    - Negative numbers and floats work by first turning each key into
+      an unsigned number that sorts in the same order.
+    - Every pass is stable, so the whole sort is stable.
 */
-int getMax(int arr[], int n) {
+#define RADIX_BITS 8
+#define RADIX_SIZE (1 << RADIX_BITS)   // 256 possible byte values
+#define RADIX_MASK (RADIX_SIZE - 1)
+
+/*
+    Function: prefixSums
+    ---------------------
+    Turns the counts of one byte position into start positions:
+
+    count = {2, 0, 3, ...}  →  start = {0, 2, 2, 5, ...}
 
-    int mx = arr[0];   // Assume first element is maximum
+    Returns 0 (skip this pass) if every key has the byte 'common'.
+*/
+static int prefixSums(size_t count[RADIX_SIZE], size_t n, unsigned common) {
 
-    for (int i = 1; i < n; i++)
-        if (arr[i] > mx)
-            mx = arr[i];
+    if (count[common] == n)
+        return 0;
 
-    return mx;
+    size_t sum = 0;
+    for (int d = 0; d < RADIX_SIZE; d++) {
+        size_t c = count[d];
+        count[d] = sum;
+        sum += c;
+    }
+    return 1;
 }
 
 /*
-    Function: countingSortForRadix
-    --------------------------------
-    Performs Counting Sort based on a specific digit
-    represented by exp (1, 10, 100, ...).
-
-    exp = 1   → units place
-    exp = 10  → tens place
-    exp = 100 → hundreds place
+    Function: radixSortU32
+    -----------------------
+    Sorts n unsigned 32-bit keys. tmp must also hold n keys: each pass
+    moves the keys from one buffer into the other.
 */
-void countingSortForRadix(int arr[], int n, int exp) {
+static void radixSortU32(uint32_t *keys, uint32_t *tmp, size_t n) {
 
-    int output[n];     // Temporary output array
-    int count[10] = {0};  // Count array for digits 0–9
+    enum { PASSES = 32 / RADIX_BITS };
 
-    /*
-        Step 1: Count occurrences of digits
-        (arr[i] / exp) % 10 extracts the required digit
-    */
-    for (int i = 0; i < n; i++)
-        count[(arr[i] / exp) % 10]++;
+    if (n < 2)
+        return;
+    size_t count[PASSES][RADIX_SIZE] = {{0}};
+
+    // Step 1: count every byte position in one go
+    for (size_t i = 0; i < n; i++)
+        for (int p = 0; p < PASSES; p++)
+            count[p][(keys[i] >> (p * RADIX_BITS)) & RADIX_MASK]++;
 
-    /*
-        Step 2: Convert count[] into cumulative count[]
-        This helps maintain stability
-    */
-    for (int i = 1; i < 10; i++)
-        count[i] += count[i - 1];
+    // Step 2: one stable counting pass per byte, lowest byte first
+    uint32_t *src = keys, *dst = tmp;
 
-    /*
-        Step 3: Build output array (Traverse from right to left)
-        Traversing backwards maintains stable sorting
-    */
-    for (int i = n - 1; i >= 0; i--) {
+    for (int p = 0; p < PASSES; p++) {
 
-        int digit = (arr[i] / exp) % 10;
+        int shift = p * RADIX_BITS;
 
-        output[count[digit] - 1] = arr[i];
-        count[digit]--;
+        if (!prefixSums(count[p], n, (src[0] >> shift) & RADIX_MASK))
+            continue;
+
+        for (size_t i = 0; i < n; i++)
+            dst[count[p][(src[i] >> shift) & RADIX_MASK]++] = src[i];
+
+        // The output of this pass is the input of the next one
+        uint32_t *t = src;
+        src = dst;
+        dst = t;
     }
 
-    /*
-        Step 4: Copy sorted elements back to original array
-    */
-    for (int i = 0; i < n; i++)
-        arr[i] = output[i];
+    if (src != keys)
+        memcpy(keys, src, n * sizeof(uint32_t));
+}
+
+/*
+    Function: radixSortU64
+    -----------------------
+    Same for unsigned 64-bit keys (8 byte positions).
+*/
+static void radixSortU64(unsigned long long *keys, unsigned long long *tmp, size_t n) {
+
+    enum { PASSES = 64 / RADIX_BITS };
+
+    if (n < 2)
+        return;
+    size_t count[PASSES][RADIX_SIZE] = {{0}};
+
+    for (size_t i = 0; i < n; i++)
+        for (int p = 0; p < PASSES; p++)
+            count[p][(keys[i] >> (p * RADIX_BITS)) & RADIX_MASK]++;
+
+    unsigned long long *src = keys, *dst = tmp;
+
+    for (int p = 0; p < PASSES; p++) {
+
+        int shift = p * RADIX_BITS;
+
+        if (!prefixSums(count[p], n, (unsigned)(src[0] >> shift) & RADIX_MASK))
+            continue;
+
+        for (size_t i = 0; i < n; i++)
+            dst[count[p][(src[i] >> shift) & RADIX_MASK]++] = src[i];
+
+        unsigned long long *t = src;
+        src = dst;
+        dst = t;
+    }
+
+    if (src != keys)
+        memcpy(keys, src, n * sizeof(unsigned long long));
+}
+
+/*
+    Function: radixSortInts
+    ------------------------
+    Sorts signed ints, negatives included.
+
+    Flipping the sign bit maps INT_MIN ... -1, 0 ... INT_MAX onto
+    0x00000000 ... 0x7FFFFFFF, 0x80000000 ... 0xFFFFFFFF, which sort in
+    the same order as unsigned numbers.
+
+    Returns 0, or -1 if the temporary buffer can't be allocated.
+*/
+int radixSortInts(int arr[], size_t n) {
+
+    if (n < 2)
+        return 0;
+
+    uint32_t *keys = (uint32_t*)arr;
+    uint32_t *tmp = malloc(n * sizeof(uint32_t));
+    if (tmp == NULL)
+        return -1;
+
+    for (size_t i = 0; i < n; i++)
+        keys[i] ^= 0x80000000u;
+
+    radixSortU32(keys, tmp, n);
+
+    for (size_t i = 0; i < n; i++)
+        keys[i] ^= 0x80000000u;
+
+    free(tmp);
+    return 0;
+}
+
+/*
+    Function: radixSortInt64
+    -------------------------
+    Same for long long (64-bit) values.
+*/
+int radixSortInt64(long long arr[], size_t n) {
+
+    if (n < 2)
+        return 0;
+
+    unsigned long long *keys = (unsigned long long*)arr;
+    unsigned long long *tmp = malloc(n * sizeof(unsigned long long));
+    if (tmp == NULL)
+        return -1;
+
+    for (size_t i = 0; i < n; i++)
+        keys[i] ^= 0x8000000000000000ull;
+
+    radixSortU64(keys, tmp, n);
+
+    for (size_t i = 0; i < n; i++)
+        keys[i] ^= 0x8000000000000000ull;
+
+    free(tmp);
+    return 0;
+}
+
+/*
+    Function: radixSortFloats
+    --------------------------
+    Sorts IEEE floats by their bit patterns.
+
+    Positive floats already compare like unsigned numbers: setting the
+    sign bit moves them above all negatives. Negative floats compare
+    backwards (a bigger magnitude is a smaller value), so all their bits
+    are inverted. -0.0 ends up just before +0.0.
+*/
+int radixSortFloats(float arr[], size_t n) {
+
+    if (n < 2)
+        return 0;
+
+    uint32_t *keys = malloc(2 * n * sizeof(uint32_t));   // keys + tmp
+    if (keys == NULL)
+        return -1;
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t b;
+        memcpy(&b, &arr[i], sizeof b);
+        keys[i] = (b & 0x80000000u) ? ~b : b ^ 0x80000000u;
+    }
+
+    radixSortU32(keys, keys + n, n);
+
+    // Undo the mapping
+    for (size_t i = 0; i < n; i++) {
+        uint32_t b = (keys[i] & 0x80000000u) ? keys[i] ^ 0x80000000u : ~keys[i];
+        memcpy(&arr[i], &b, sizeof b);
+    }
+
+    free(keys);
+    return 0;
+}
+
+/*
+    Function: radixSortRecords
+    ---------------------------
+    Key + payload: sorts n records (structs) of 'size' bytes each by
+    the int stored at keyOffset inside them, e.g.
+
+    radixSortRecords(students, n, sizeof(Student), offsetof(Student, rollNo));
+
+    Whole records are moved, so the rest of each record travels with its
+    key. Because the sort is stable, records with equal keys keep their
+    earlier order.
+*/
+int radixSortRecords(void *base, size_t n, size_t size, size_t keyOffset) {
+
+    enum { PASSES = 32 / RADIX_BITS };
+
+    if (n < 2)
+        return 0;
+
+    char *tmp = malloc(n * size);
+    if (tmp == NULL)
+        return -1;
+
+    size_t count[PASSES][RADIX_SIZE] = {{0}};
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t k;
+        memcpy(&k, (char*)base + i * size + keyOffset, sizeof k);
+        k ^= 0x80000000u;     // signed key
+        for (int p = 0; p < PASSES; p++)
+            count[p][(k >> (p * RADIX_BITS)) & RADIX_MASK]++;
+    }
+
+    char *src = base, *dst = tmp;
+
+    for (int p = 0; p < PASSES; p++) {
+
+        int shift = p * RADIX_BITS;
+        uint32_t first;
+        memcpy(&first, src + keyOffset, sizeof first);
+
+        if (!prefixSums(count[p], n, ((first ^ 0x80000000u) >> shift) & RADIX_MASK))
+            continue;
+
+        for (size_t i = 0; i < n; i++) {
+            uint32_t k;
+            memcpy(&k, src + i * size + keyOffset, sizeof k);
+            size_t to = count[p][((k ^ 0x80000000u) >> shift) & RADIX_MASK]++;
+            memcpy(dst + to * size, src + i * size, size);
+        }
+
+        char *t = src;
+        src = dst;
+        dst = t;
+    }
+
+    if (src != (char*)base)
+        memcpy(base, src, n * size);
+
+    free(tmp);
+    return 0;
 }
 
 /*
     Function: radixSort
     ---------------------
-    Main Radix Sort algorithm.
-
-    Steps:
-    1. Find maximum number.
-    2. Apply counting sort for every digit
-       from least significant to most significant.
+    Sorts an int array, negative numbers included.
 */
 void radixSort(int arr[], int n) {
 
-    int m = getMax(arr, n);  // Maximum number
-
-    /*
-        Apply counting sort for each digit
-        exp = 1, 10, 100, 1000...
-    */
-    for (int exp = 1; m / exp > 0; exp *= 10)
-        countingSortForRadix(arr, n, exp);
+    if (n > 1)
+        radixSortInts(arr, (size_t)n);
 }
 
 /*
     Main Function
     --------------
     1. Take input size.
-    2. Take non-negative integers.
+    2. Take integers (negative ones too).
     3. Call radixSort().
     4. Print sorted array.
 */
 int main() {
 
-    int n, arr[100];
+    int n;
 
     printf("Enter size: ");
     scanf("%d", &n);
 
-    printf("Enter non-negative integers: ");
+    int *arr = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (arr == NULL)
+        return 1;
+
+    printf("Enter integers: ");
     for (int i = 0; i < n; i++)
         scanf("%d", &arr[i]);
 
@@ -117,5 +330,6 @@ int main() {
 
     printf("\n");
 
+    free(arr);
     return 0;
 }
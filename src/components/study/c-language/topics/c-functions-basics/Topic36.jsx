@@ -5,6 +5,11 @@ import monolithicStudent from "./topic36_files/monolithic_student.c?raw";
 import modularStudentHeader from "./topic36_files/modular_student.h.c?raw";
 import modularStudentMain from "./topic36_files/modular_student_main.c?raw";
 import modularStudentImpl from "./topic36_files/modular_student_impl.c?raw";
+import studentIndexBench from "./topic36_files/student_index_bench.c?raw";
+import studentColumnar from "./topic36_files/student_columnar.c?raw";
+import studentColumnarBench from "./topic36_files/student_columnar_bench.c?raw";
+import studentCsvImport from "./topic36_files/student_csv_import.c?raw";
+import studentCsvBench from "./topic36_files/student_csv_bench.c?raw";
 
 const Topic36 = () => {
   // Calculate teacher's experience dynamically
@@ -146,6 +151,26 @@ const Topic36 = () => {
                 title="modular_student_main.c – Main program"
                 initialCode={modularStudentMain}
               />
+              <EditableCCodeBlock
+                title="student_index_bench.c – Hash index vs linear scan benchmark"
+                initialCode={studentIndexBench}
+              />
+              <EditableCCodeBlock
+                title="student_columnar.c – Column (structure-of-arrays) store and scan kernels"
+                initialCode={studentColumnar}
+              />
+              <EditableCCodeBlock
+                title="student_columnar_bench.c – Row vs column scan benchmark"
+                initialCode={studentColumnarBench}
+              />
+              <EditableCCodeBlock
+                title="student_csv_import.c – Parallel bulk CSV importer"
+                initialCode={studentCsvImport}
+              />
+              <EditableCCodeBlock
+                title="student_csv_bench.c – CSV import speed vs thread count"
+                initialCode={studentCsvBench}
+              />
             </div>
             <p className="mt-3 text-gray-600 dark:text-gray-400">
               Tuhina split the system into modules. Now the team can work in
@@ -2,7 +2,7 @@
 #ifndef STUDENT_MODULE_H
 #define STUDENT_MODULE_H
 
-#define MAX_STUDENTS 100
+#define INITIAL_CAPACITY 64      // the store doubles as needed, no fixed maximum
 #define NAME_LEN 50
 
 typedef struct {
@@ -17,9 +17,75 @@ void addStudent();
 void displayAll();
 float calculateAverage();
 void searchById();
+void deleteStudent();
+void showStatistics();
+
+// Aggregates, kept up to date on every change: all O(1)
+#define MARK_BANDS 10           // 0-9, 10-19, ..., 90-100
+double averageMarks();
+double minMarks();
+double maxMarks();
+long marksInBand(int band);
+
+// Record store (non-interactive). Lookups by id go through a hash index.
+int addRecord(const Student *s);        // 0 on success, -1 if the id exists or no memory
+int addRecords(const Student *recs, int n);  // bulk add, returns number added (-1: no memory)
+int removeRecord(int id);                // 0 on success, -1 if not found
+const Student* findById(int id);        // NULL if not found
+int studentTotal();
+const Student* studentAt(int index);
+void clearStudents();
+
+// Columnar copy of the records (see student_columnar.c). The store keeps
+// one up to date on every add and delete; studentColumns() returns it.
+// id/age/marks each live in their own contiguous array and names in one
+// shared heap, so a scan over marks reads only marks: 4 bytes per
+// student instead of a whole 64-byte Student.
+typedef struct {
+    int count, capacity;
+    int *id;
+    int *age;
+    float *marks;
+    int *nameOffset;            // start of each name in 'names'
+    char *names;                // NUL-terminated names back to back
+    int namesUsed, namesCapacity;
+    int namesGarbage;           // bytes of removed names still in 'names'
+} StudentColumns;
+
+void columnsInit(StudentColumns *c);
+void columnsFree(StudentColumns *c);
+void columnsClear(StudentColumns *c);                      // drop all rows, keep the memory
+int columnsAppend(StudentColumns *c, const Student *s);    // 0 on success
+void columnsRemove(StudentColumns *c, int row);            // last row moves into 'row'
+int columnsFromStore(StudentColumns *c);                   // copy the current records
+const StudentColumns* studentColumns();                    // the store's own copy, NULL if out of memory
+Student columnsRow(const StudentColumns *c, int row);      // row view for display
+double columnsAverage(const StudentColumns *c);
+int columnsCountWhere(const StudentColumns *c, float minMarks, int maxAge);
+// Writes the rows with marks > minMarks && age < maxAge to out[], returns how many
+int columnsFilter(const StudentColumns *c, float minMarks, int maxAge, int *out);
+void filterStudents();
 
 // File I/O
-void saveToFile();
-void loadFromFile();
+// Records are stored in a versioned binary file (DB_FILE) that loads with
+// mmap and needs no parsing. Adds and deletes made in between are appended
+// to JOURNAL_FILE and replayed on load; saveToFile() folds the journal into
+// a new DB_FILE. The text format stays available for import/export (one
+// "id name age marks" line per student).
+#define DB_FILE      "students.db"
+#define JOURNAL_FILE "students.log"
+#define TEXT_FILE    "students.txt"
+
+void saveToFile();              // compaction: new snapshot, empty journal
+int loadFromFile();             // snapshot + journal replay; -1 if DB_FILE is unusable
+void journalSync();             // force journaled changes to disk
+int exportText(const char *path);   // returns number of records, -1 on error
+int importText(const char *path);
+
+// Bulk CSV import ("id,name,age,marks" per line), see student_csv_import.c.
+// The file is split across 'threads' parser threads (0 = one per core).
+// Returns the number of records added, -1 on error.
+int importCsv(const char *path, int threads);
+void bulkImport();
 
 #endif
\ No newline at end of file
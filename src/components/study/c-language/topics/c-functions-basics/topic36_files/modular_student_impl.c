@@ -1,26 +1,282 @@
 // modular_student_impl.c – Implementation of student module
 #include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
 #include "modular_student.h"  // Note: in real code this would be "modular_student.h"
 
-static Student students[MAX_STUDENTS];
+static Student *students = NULL;
 static int studentCount = 0;
+static int studentCapacity = 0;
 
-void addStudent() {
-    if (studentCount >= MAX_STUDENTS) {
-        printf("Database full!\n");
-        return;
+// ---------------- Hash index: id -> slot in students[] ----------------
+// Open addressing with linear probing. Each entry keeps the id next to
+// the slot, so a probe never has to touch the (much larger) records.
+// The table is a power of two and kept at most half full.
+
+typedef struct {
+    int id;
+    int slot;                   // -1 = empty
+} IndexEntry;
+
+static IndexEntry *idIndex = NULL;
+static unsigned indexMask = 0;  // table size - 1
+
+static unsigned hashId(int id) {
+    return ((uint32_t)id * 2654435761u) & indexMask;    // Fibonacci hashing
+}
+
+static int indexFind(int id) {
+    if (!idIndex) return -1;
+    for (unsigned h = hashId(id); idIndex[h].slot != -1; h = (h + 1) & indexMask) {
+        if (idIndex[h].id == id) return idIndex[h].slot;
     }
-    Student s;
+    return -1;
+}
+
+static void indexInsert(int id, int slot) {
+    unsigned h = hashId(id);
+    while (idIndex[h].slot != -1) h = (h + 1) & indexMask;
+    idIndex[h].id = id;
+    idIndex[h].slot = slot;
+}
+
+// Remove 'id' and shift later entries of the same probe run back,
+// so no "deleted" markers are needed
+static void indexErase(int id) {
+    unsigned h = hashId(id);
+    while (idIndex[h].slot != -1 && idIndex[h].id != id) h = (h + 1) & indexMask;
+    if (idIndex[h].slot == -1) return;
+    unsigned hole = h;
+    for (unsigned j = (h + 1) & indexMask; idIndex[j].slot != -1; j = (j + 1) & indexMask) {
+        unsigned home = hashId(idIndex[j].id);
+        // Move entry j into the hole unless its home lies in (hole, j]
+        if (((j - home) & indexMask) >= ((j - hole) & indexMask)) {
+            idIndex[hole] = idIndex[j];
+            hole = j;
+        }
+    }
+    idIndex[hole].slot = -1;
+}
+
+static void indexUpdate(int id, int slot) {
+    unsigned h = hashId(id);
+    while (idIndex[h].id != id) h = (h + 1) & indexMask;
+    idIndex[h].slot = slot;
+}
+
+// Make the table big enough for 'count' entries at load factor <= 1/2
+// and rebuild it from the records
+static int indexRebuild(int count) {
+    unsigned size = 16;
+    while (size < 2u * (unsigned)count) size *= 2;
+    IndexEntry *table = malloc(size * sizeof(IndexEntry));
+    if (!table) return -1;
+    free(idIndex);
+    idIndex = table;
+    indexMask = size - 1;
+    for (unsigned i = 0; i < size; i++) idIndex[i].slot = -1;
+    for (int i = 0; i < studentCount; i++) indexInsert(students[i].id, i);
+    return 0;
+}
+
+// ---------------- Running aggregates ----------------
+// Updated on every add/remove/load so that average, min, max and the
+// marks distribution are O(1) queries. The sum uses Neumaier's compensated
+// summation in double, so it stays exact even for millions of records.
+
+static struct {
+    double sum, compensation;
+    double min, max;
+    int minMaxStale;            // a removal took away the current min or max
+    long bands[MARK_BANDS];
+} stats;
+
+static int markBand(float marks) {
+    int b = (int)(marks / 10);
+    return b < 0 ? 0 : b >= MARK_BANDS ? MARK_BANDS - 1 : b;
+}
+
+static void statsAddTerm(double x) {
+    double t = stats.sum + x;
+    if (fabs(stats.sum) >= fabs(x)) stats.compensation += (stats.sum - t) + x;
+    else                            stats.compensation += (x - t) + stats.sum;
+    stats.sum = t;
+}
+
+static void statsAdd(const Student *s) {
+    statsAddTerm(s->marks);
+    if (studentCount == 0 || s->marks < stats.min) stats.min = s->marks;
+    if (studentCount == 0 || s->marks > stats.max) stats.max = s->marks;
+    stats.bands[markBand(s->marks)]++;
+}
+
+static void statsRemove(const Student *s) {
+    statsAddTerm(-(double)s->marks);
+    if (s->marks == stats.min || s->marks == stats.max) stats.minMaxStale = 1;
+    stats.bands[markBand(s->marks)]--;
+}
+
+static void statsReset() {
+    memset(&stats, 0, sizeof stats);
+}
+
+// Only after removing an extreme value do we need one rescan
+static void statsRefreshMinMax() {
+    if (!stats.minMaxStale) return;
+    for (int i = 0; i < studentCount; i++) {
+        if (i == 0 || students[i].marks < stats.min) stats.min = students[i].marks;
+        if (i == 0 || students[i].marks > stats.max) stats.max = students[i].marks;
+    }
+    stats.minMaxStale = 0;
+}
+
+double averageMarks() {
+    return studentCount ? (stats.sum + stats.compensation) / studentCount : 0;
+}
+
+double minMarks() {
+    statsRefreshMinMax();
+    return studentCount ? stats.min : 0;
+}
+
+double maxMarks() {
+    statsRefreshMinMax();
+    return studentCount ? stats.max : 0;
+}
+
+long marksInBand(int band) {
+    return band >= 0 && band < MARK_BANDS ? stats.bands[band] : 0;
+}
+
+// ---------------- Record store ----------------
+
+static int reserveStudents(int needed) {
+    if (needed <= studentCapacity) return 0;
+    int cap = studentCapacity ? studentCapacity : INITIAL_CAPACITY;
+    while (cap < needed) cap *= 2;
+    Student *tmp = realloc(students, (size_t)cap * sizeof(Student));
+    if (!tmp) return -1;
+    students = tmp;
+    studentCapacity = cap;
+    return 0;
+}
+
+// Columnar copy, updated alongside students[]. If an append runs out of
+// memory it is marked stale and rebuilt on the next studentColumns().
+static StudentColumns columns;
+static int columnsStale = 0;
+
+static void columnsReset() {
+    columnsClear(&columns);
+    columnsStale = 0;
+}
+
+const StudentColumns* studentColumns() {
+    if (columnsStale) {
+        if (columnsFromStore(&columns) != 0) return NULL;
+        columnsStale = 0;
+    }
+    return &columns;
+}
+
+// Caller guarantees room in students[] and idIndex and a new id
+static void appendRecord(const Student *s) {
+    statsAdd(s);
+    students[studentCount] = *s;
+    indexInsert(s->id, studentCount);
+    studentCount++;
+    if (!columnsStale && columnsAppend(&columns, s) != 0) columnsStale = 1;
+}
+
+int addRecord(const Student *s) {
+    if (indexFind(s->id) != -1) return -1;
+    if (reserveStudents(studentCount + 1) != 0) return -1;
+    if (2u * (unsigned)(studentCount + 1) > indexMask + 1 || !idIndex) {
+        if (indexRebuild(studentCount + 1) != 0) return -1;
+    }
+    appendRecord(s);
+    return 0;
+}
+
+// Bulk version of addRecord: one reallocation and at most one index
+// rebuild for the whole batch. Returns how many records were added.
+int addRecords(const Student *recs, int n) {
+    if (n <= 0) return 0;
+    if (reserveStudents(studentCount + n) != 0) return -1;
+    if (2u * (unsigned)(studentCount + n) > indexMask + 1 || !idIndex) {
+        if (indexRebuild(studentCount + n) != 0) return -1;
+    }
+    int before = studentCount;
+    for (int i = 0; i < n; i++) {
+        if (indexFind(recs[i].id) == -1) appendRecord(&recs[i]);
+    }
+    return studentCount - before;
+}
+
+int removeRecord(int id) {
+    int slot = indexFind(id);
+    if (slot == -1) return -1;
+    statsRemove(&students[slot]);
+    indexErase(id);
+    // Fill the hole with the last record so the array stays dense
+    studentCount--;
+    if (studentCount == 0) statsReset();  // drop any rounding residue
+    if (slot != studentCount) {
+        students[slot] = students[studentCount];
+        indexUpdate(students[slot].id, slot);
+    }
+    if (!columnsStale) columnsRemove(&columns, slot);
+    return 0;
+}
+
+const Student* findById(int id) {
+    int slot = indexFind(id);
+    return slot == -1 ? NULL : &students[slot];
+}
+
+int studentTotal() {
+    return studentCount;
+}
+
+const Student* studentAt(int index) {
+    return index >= 0 && index < studentCount ? &students[index] : NULL;
+}
+
+void clearStudents() {
+    studentCount = 0;
+    statsReset();
+    columnsReset();
+    if (idIndex) for (unsigned i = 0; i <= indexMask; i++) idIndex[i].slot = -1;
+}
+
+// Interactive changes are journaled (see the Journal section below)
+enum { JOURNAL_PUT = 1, JOURNAL_DELETE = 2 };
+static void journalAppend(int op, const Student *s);
+
+void addStudent() {
+    Student s = {0};                  // no stray bytes end up in the file
     printf("Enter ID: ");
     scanf("%d", &s.id);
     printf("Enter name: ");
-    scanf("%s", s.name);
+    scanf(" %49[^\n]", s.name);       // names may contain spaces
     printf("Enter age: ");
     scanf("%d", &s.age);
     printf("Enter marks: ");
     scanf("%f", &s.marks);
-    students[studentCount++] = s;
+    if (addRecord(&s) != 0) {
+        printf(findById(s.id) ? "A student with ID %d already exists.\n"
+                              : "Out of memory, student %d not added.\n", s.id);
+        return;
+    }
+    journalAppend(JOURNAL_PUT, &s);
     printf("Student added.\n");
 }
 
@@ -33,53 +289,341 @@ void displayAll() {
 }
 
 float calculateAverage() {
-    if (studentCount == 0) return 0;
-    float sum = 0;
-    for (int i = 0; i < studentCount; i++) {
-        sum += students[i].marks;
+    return (float)averageMarks();       // O(1): maintained as records change
+}
+
+void deleteStudent() {
+    int id;
+    printf("Enter ID to delete: ");
+    scanf("%d", &id);
+    if (removeRecord(id) != 0) {
+        printf("Student not found.\n");
+        return;
+    }
+    Student s = { .id = id };
+    journalAppend(JOURNAL_DELETE, &s);
+    printf("Student deleted.\n");
+}
+
+void showStatistics() {
+    printf("\nStudents: %d, Average: %.4f, Min: %.2f, Max: %.2f\n",
+           studentCount, averageMarks(), minMarks(), maxMarks());
+    for (int b = 0; b < MARK_BANDS; b++) {
+        printf("%3d-%-3d %ld\n", b * 10, b == MARK_BANDS - 1 ? 100 : b * 10 + 9, marksInBand(b));
     }
-    return sum / studentCount;
 }
 
 void searchById() {
     int id;
     printf("Enter ID to search: ");
     scanf("%d", &id);
-    for (int i = 0; i < studentCount; i++) {
-        if (students[i].id == id) {
-            printf("Found: %s, Age: %d, Marks: %.2f\n",
-                   students[i].name, students[i].age, students[i].marks);
-            return;
-        }
+    const Student *s = findById(id);      // O(1) via the hash index
+    if (s) {
+        printf("Found: %s, Age: %d, Marks: %.2f\n", s->name, s->age, s->marks);
+        return;
     }
     printf("Student not found.\n");
 }
 
-void saveToFile() {
-    FILE *fp = fopen("students.txt", "w");
-    if (!fp) {
+// ---------------- Binary storage ----------------
+// File layout: DbHeader followed by 'count' raw Student records.
+// The record size is stored too, so a build with a different Student
+// layout refuses the file instead of misreading it.
+
+#define DB_MAGIC   "STDB"
+#define DB_VERSION 1
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t reserved;
+    uint64_t count;
+} DbHeader;
+
+// The rename itself lives in the directory, so the directory has to be
+// fsync'ed too before the new name is guaranteed to survive a crash.
+static int syncDirOf(const char *path) {
+    const char *slash = strrchr(path, '/');
+    char dir[4096] = ".";
+    if (slash) {
+        size_t len = slash == path ? 1 : (size_t)(slash - path);
+        if (len >= sizeof dir) return -1;
+        memcpy(dir, path, len);
+        dir[len] = '\0';
+    }
+    int fd = open(dir, O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return -1;
+    int rc = fsync(fd);
+    close(fd);
+    return rc;
+}
+
+// Header and records go out in a single writev() to a temporary file,
+// which is fsync'ed and renamed over the old one, and then the directory
+// is fsync'ed so the rename is durable. A crash mid-save leaves the
+// previous file intact.
+static int writeSnapshot() {
+    const char *tmp = DB_FILE ".tmp";
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
         printf("Error opening file!\n");
+        return -1;
+    }
+    DbHeader h = { DB_MAGIC, DB_VERSION, sizeof(Student), 0, (uint64_t)studentCount };
+    struct iovec iov[2] = {
+        { &h, sizeof h },
+        { students, (size_t)studentCount * sizeof(Student) },
+    };
+    ssize_t expected = (ssize_t)(iov[0].iov_len + iov[1].iov_len);
+    if (writev(fd, iov, 2) != expected || fsync(fd) != 0) {
+        printf("Error writing file!\n");
+        close(fd);
+        unlink(tmp);
+        return -1;
+    }
+    close(fd);
+    if (rename(tmp, DB_FILE) != 0) {
+        printf("Error replacing %s!\n", DB_FILE);
+        unlink(tmp);
+        return -1;
+    }
+    if (syncDirOf(DB_FILE) != 0) {
+        printf("Error syncing the directory of %s!\n", DB_FILE);
+        return -1;
+    }
+    return 0;
+}
+
+// ---------------- Journal ----------------
+// Every change made through the menu is appended to JOURNAL_FILE as one
+// fixed-size record with a CRC, so a save costs one small write instead
+// of rewriting the whole table. The file is fdatasync'ed every
+// JOURNAL_BATCH records, which bounds what a power failure can lose.
+// Loading replays the journal on top of the snapshot in DB_FILE;
+// compaction writes a fresh snapshot and empties the journal.
+
+#define JOURNAL_BATCH       16
+#define JOURNAL_COMPACT_MIN 1024    // compact when the journal outgrows the table
+
+typedef struct {
+    uint32_t crc;               // CRC-32 of everything after this field
+    uint32_t op;
+    Student student;            // only the id is used for JOURNAL_DELETE
+} JournalRecord;
+
+static int journalFd = -1;
+static int journalPending = 0;  // appended but not yet fdatasync'ed
+static int journalRecords = 0;  // records in the file
+
+static uint32_t crc32(const void *data, size_t len) {
+    static uint32_t table[256];
+    if (!table[1]) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c >> 1) ^ (0xEDB88320u & -(c & 1));
+            table[i] = c;
+        }
+    }
+    const unsigned char *p = data;
+    uint32_t c = 0xFFFFFFFFu;
+    while (len--) c = table[(c ^ *p++) & 0xFF] ^ (c >> 8);
+    return c ^ 0xFFFFFFFFu;
+}
+
+static uint32_t journalChecksum(const JournalRecord *r) {
+    return crc32(&r->op, sizeof *r - sizeof r->crc);
+}
+
+static int journalOpen() {
+    if (journalFd < 0) journalFd = open(JOURNAL_FILE, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    return journalFd;
+}
+
+void journalSync() {
+    if (journalFd >= 0 && journalPending > 0 && fdatasync(journalFd) == 0) journalPending = 0;
+}
+
+// Snapshot first, then empty the journal - only once the snapshot's
+// rename is on disk, or a crash could leave the old snapshot next to an
+// empty journal. If we crash in between, the old journal is replayed onto
+// the new snapshot, which is harmless: the replay result only depends on
+// the last record for each id.
+static int compact() {
+    if (writeSnapshot() != 0) return -1;
+    if (journalOpen() < 0 || ftruncate(journalFd, 0) != 0) return -1;
+    journalPending = journalRecords = 0;
+    return 0;
+}
+
+static void journalAppend(int op, const Student *s) {
+    JournalRecord r;
+    memset(&r, 0, sizeof r);
+    r.op = op;
+    if (op == JOURNAL_PUT) r.student = *s;
+    else r.student.id = s->id;
+    r.crc = journalChecksum(&r);
+
+    if (journalOpen() < 0 || write(journalFd, &r, sizeof r) != (ssize_t)sizeof r) {
+        printf("Warning: could not write %s, change is not saved!\n", JOURNAL_FILE);
+        return;
+    }
+    journalRecords++;
+    if (++journalPending >= JOURNAL_BATCH) journalSync();
+    if (journalRecords >= JOURNAL_COMPACT_MIN && journalRecords > studentCount) compact();
+}
+
+// Apply every intact record. A torn or corrupt tail (crash mid-write)
+// ends the replay and is cut off so new records follow valid ones.
+static void journalReplay() {
+    int fd = open(JOURNAL_FILE, O_RDWR);
+    if (fd < 0) return;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return;
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+        printf("Error mapping %s!\n", JOURNAL_FILE);
+        close(fd);
         return;
     }
+    const JournalRecord *recs = map;
+    size_t total = (size_t)st.st_size / sizeof(JournalRecord), applied = 0;
+    for (; applied < total; applied++) {
+        const JournalRecord *r = &recs[applied];
+        if (r->crc != journalChecksum(r)) break;
+        if (r->op == JOURNAL_PUT) {
+            removeRecord(r->student.id);
+            addRecord(&r->student);
+        } else if (r->op == JOURNAL_DELETE) {
+            removeRecord(r->student.id);
+        } else {
+            break;
+        }
+    }
+    munmap(map, st.st_size);
+    size_t good = applied * sizeof(JournalRecord);
+    if (good != (size_t)st.st_size) {
+        printf("Dropped a damaged tail of %s.\n", JOURNAL_FILE);
+        if (ftruncate(fd, (off_t)good) != 0) printf("Error truncating %s!\n", JOURNAL_FILE);
+    }
+    close(fd);
+    journalRecords = (int)applied;
+    if (applied) printf("Replayed %zu journal records.\n", applied);
+}
+
+// Explicit save = compaction: fold the journal into a new snapshot
+void saveToFile() {
+    if (compact() == 0) printf("Data saved.\n");
+}
+
+// Map the file and copy the records straight in: no parsing at all.
+// If there is no binary file yet, fall back to importing the text file.
+// Returns -1 if DB_FILE exists but could not be loaded.
+static int loadSnapshot() {
+    int fd = open(DB_FILE, O_RDONLY);
+    if (fd < 0) {
+        if (errno != ENOENT) {
+            printf("Error opening %s!\n", DB_FILE);
+            return -1;
+        }
+        if (importText(TEXT_FILE) >= 0) printf("Data imported from %s.\n", TEXT_FILE);
+        return 0;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(DbHeader)) {
+        printf("%s is too short.\n", DB_FILE);
+        close(fd);
+        return -1;
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        printf("Error mapping %s!\n", DB_FILE);
+        return -1;
+    }
+    const DbHeader *h = map;
+    if (memcmp(h->magic, DB_MAGIC, 4) != 0 || h->version != DB_VERSION ||
+        h->record_size != sizeof(Student) ||
+        h->count > ((size_t)st.st_size - sizeof(DbHeader)) / sizeof(Student)) {
+        printf("%s is not a valid version %d student file.\n", DB_FILE, DB_VERSION);
+        munmap(map, st.st_size);
+        return -1;
+    }
+    int count = (int)h->count;
+    clearStudents();                // count, stats, columns and index together
+    if (reserveStudents(count) != 0 || indexRebuild(count) != 0) {
+        printf("Not enough memory for %d records!\n", count);
+        munmap(map, st.st_size);
+        return -1;
+    }
+    // Copy and index the records (skipping any duplicate ids)
+    const Student *recs = (const Student*)((const char*)map + sizeof(DbHeader));
+    for (int i = 0; i < count; i++) {
+        if (indexFind(recs[i].id) != -1) continue;
+        appendRecord(&recs[i]);
+    }
+    munmap(map, st.st_size);
+    printf("Data loaded.\n");
+    return 0;
+}
+
+// The journal only holds changes on top of the snapshot. Replaying it onto
+// an empty table, and saving that, would overwrite the real file with a
+// fraction of it, so an unusable DB_FILE stops the load instead.
+int loadFromFile() {
+    if (loadSnapshot() != 0) {
+        printf("%s was left untouched; fix it or move it aside and restart.\n", DB_FILE);
+        return -1;
+    }
+    journalReplay();
+    return 0;
+}
+
+// ---------------- Text import/export ----------------
+
+int exportText(const char *path) {
+    FILE *fp = fopen(path, "w");
+    if (!fp) return -1;
     for (int i = 0; i < studentCount; i++) {
         fprintf(fp, "%d %s %d %.2f\n",
                 students[i].id, students[i].name, students[i].age, students[i].marks);
     }
     fclose(fp);
-    printf("Data saved.\n");
+    return studentCount;
 }
 
-void loadFromFile() {
-    FILE *fp = fopen("students.txt", "r");
-    if (!fp) return;
-    studentCount = 0;
-    while (fscanf(fp, "%d %s %d %f",
-                  &students[studentCount].id,
-                  students[studentCount].name,
-                  &students[studentCount].age,
-                  &students[studentCount].marks) == 4) {
-        studentCount++;
+// Parse "id name with spaces age marks": id from the front, marks and age
+// from the back, and everything in between is the name
+static int parseTextLine(char *line, Student *s) {
+    int used;
+    if (sscanf(line, "%d %n", &s->id, &used) != 1) return 0;
+    char *end = line + strlen(line);
+    while (end > line && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ')) *--end = '\0';
+    char *marks = strrchr(line + used, ' ');
+    if (!marks) return 0;
+    *marks++ = '\0';
+    char *age = strrchr(line + used, ' ');
+    if (!age) return 0;
+    *age++ = '\0';
+    if (sscanf(age, "%d", &s->age) != 1 || sscanf(marks, "%f", &s->marks) != 1) return 0;
+    snprintf(s->name, NAME_LEN, "%s", line + used);
+    return 1;
+}
+
+int importText(const char *path) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) return -1;
+    char line[256];
+    Student s;
+    clearStudents();
+    while (fgets(line, sizeof line, fp)) {
+        memset(&s, 0, sizeof s);
+        if (parseTextLine(line, &s))
+            addRecord(&s);              // duplicates are skipped
     }
     fclose(fp);
-    printf("Data loaded.\n");
-}
\ No newline at end of file
+    return studentCount;
+}
@@ -4,17 +4,32 @@
 
 int main() {
     int choice;
-    loadFromFile();
+    if (loadFromFile() != 0) return 1;
     do {
-        printf("\n1. Add Student\n2. Display All\n3. Average Marks\n4. Search by ID\n5. Save\n6. Exit\nChoice: ");
-        scanf("%d", &choice);
+        printf("\n1. Add Student\n2. Display All\n3. Average Marks\n4. Search by ID\n5. Save\n6. Exit\n"
+               "7. Export to text\n8. Import from text\n9. Delete Student\n10. Statistics\n"
+               "11. Filter by marks and age\n12. Bulk import CSV\nChoice: ");
+        if (scanf("%d", &choice) != 1) break;
         switch (choice) {
             case 1: addStudent(); break;
             case 2: displayAll(); break;
             case 3: printf("Average: %.2f\n", calculateAverage()); break;
             case 4: searchById(); break;
             case 5: saveToFile(); break;
+            case 7: printf("Exported %d records.\n", exportText(TEXT_FILE)); break;
+            case 8:
+                printf("Imported %d records.\n", importText(TEXT_FILE));
+                saveToFile();           // the journal describes the old table
+                break;
+            case 9: deleteStudent(); break;
+            case 10: showStatistics(); break;
+            case 11: filterStudents(); break;
+            case 12:
+                bulkImport();
+                saveToFile();
+                break;
         }
     } while (choice != 6);
+    journalSync();
     return 0;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 // monolithic_student.c – All‑in‑one student record system (hard to maintain)
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 
 #define MAX_STUDENTS 100
 #define NAME_LEN 50
@@ -14,6 +15,14 @@ typedef struct {
 
 Student students[MAX_STUDENTS];
 int studentCount = 0;
+double marksSum = 0, marksCompensation = 0;   // running total (Neumaier summation)
+
+void addToTotal(double x) {
+    double t = marksSum + x;
+    if (fabs(marksSum) >= fabs(x)) marksCompensation += (marksSum - t) + x;
+    else                           marksCompensation += (x - t) + marksSum;
+    marksSum = t;
+}
 
 void addStudent() {
     if (studentCount >= MAX_STUDENTS) {
@@ -30,6 +39,7 @@ void addStudent() {
     printf("Enter marks: ");
     scanf("%f", &s.marks);
     students[studentCount++] = s;
+    addToTotal(s.marks);
     printf("Student added.\n");
 }
 
@@ -43,11 +53,7 @@ void displayAll() {
 
 float calculateAverage() {
     if (studentCount == 0) return 0;
-    float sum = 0;
-    for (int i = 0; i < studentCount; i++) {
-        sum += students[i].marks;
-    }
-    return sum / studentCount;
+    return (float)((marksSum + marksCompensation) / studentCount);
 }
 
 void searchById() {
@@ -82,11 +88,14 @@ void loadFromFile() {
     FILE *fp = fopen("students.txt", "r");
     if (!fp) return;
     studentCount = 0;
-    while (fscanf(fp, "%d %s %d %f",
+    marksSum = marksCompensation = 0;
+    while (studentCount < MAX_STUDENTS &&
+           fscanf(fp, "%d %s %d %f",
                   &students[studentCount].id,
                   students[studentCount].name,
                   &students[studentCount].age,
                   &students[studentCount].marks) == 4) {
+        addToTotal(students[studentCount].marks);
         studentCount++;
     }
     fclose(fp);
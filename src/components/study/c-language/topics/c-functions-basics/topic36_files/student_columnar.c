@@ -0,0 +1,195 @@
+// student_columnar.c – Structure-of-arrays copy of the student records
+// The kernels below are plain loops over contiguous int/float arrays with
+// no branches in the body, which GCC and Clang turn into SIMD code
+// (-O3, or -O2 on GCC 12+; check with -fopt-info-vec).
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "modular_student.h"
+
+#define COLUMN_ALIGN 64         // one cache line; also suits AVX-512 loads
+
+static void* alignedGrow(void *old, size_t oldBytes, size_t newBytes) {
+    newBytes = (newBytes + COLUMN_ALIGN - 1) & ~(size_t)(COLUMN_ALIGN - 1);
+    void *p = aligned_alloc(COLUMN_ALIGN, newBytes);
+    if (p && old) memcpy(p, old, oldBytes);
+    if (p) free(old);
+    return p;
+}
+
+void columnsInit(StudentColumns *c) {
+    memset(c, 0, sizeof *c);
+}
+
+void columnsClear(StudentColumns *c) {
+    c->count = 0;
+    c->namesUsed = 0;
+    c->namesGarbage = 0;
+}
+
+void columnsFree(StudentColumns *c) {
+    free(c->id);
+    free(c->age);
+    free(c->marks);
+    free(c->nameOffset);
+    free(c->names);
+    columnsInit(c);
+}
+
+static int columnsReserve(StudentColumns *c, int rows) {
+    if (rows <= c->capacity) return 0;
+    int cap = c->capacity ? c->capacity : INITIAL_CAPACITY;
+    while (cap < rows) cap *= 2;
+    size_t oldInts = (size_t)c->count * sizeof(int), newInts = (size_t)cap * sizeof(int);
+    int *id = alignedGrow(c->id, oldInts, newInts);
+    if (!id) return -1;
+    c->id = id;
+    int *age = alignedGrow(c->age, oldInts, newInts);
+    if (!age) return -1;
+    c->age = age;
+    float *marks = alignedGrow(c->marks, (size_t)c->count * sizeof(float), (size_t)cap * sizeof(float));
+    if (!marks) return -1;
+    c->marks = marks;
+    int *off = realloc(c->nameOffset, (size_t)cap * sizeof(int));
+    if (!off) return -1;
+    c->nameOffset = off;
+    c->capacity = cap;
+    return 0;
+}
+
+int columnsAppend(StudentColumns *c, const Student *s) {
+    if (columnsReserve(c, c->count + 1) != 0) return -1;
+    int len = (int)strnlen(s->name, NAME_LEN - 1) + 1;
+    if (c->namesUsed + len > c->namesCapacity) {
+        int cap = c->namesCapacity ? c->namesCapacity * 2 : 1024;
+        while (cap < c->namesUsed + len) cap *= 2;
+        char *names = realloc(c->names, cap);
+        if (!names) return -1;
+        c->names = names;
+        c->namesCapacity = cap;
+    }
+    memcpy(c->names + c->namesUsed, s->name, len - 1);
+    c->names[c->namesUsed + len - 1] = '\0';
+
+    int row = c->count++;
+    c->id[row] = s->id;
+    c->age[row] = s->age;
+    c->marks[row] = s->marks;
+    c->nameOffset[row] = c->namesUsed;
+    c->namesUsed += len;
+    return 0;
+}
+
+// Same order as the row store: the last row fills the hole. The removed
+// name stays in the heap until garbage makes up half of it; then the live
+// names are copied into a fresh heap.
+void columnsRemove(StudentColumns *c, int row) {
+    int last = --c->count;
+    int start = c->nameOffset[row];
+    int len = (int)strlen(c->names + start) + 1;
+    if (start + len == c->namesUsed) c->namesUsed = start;    // newest name: just give it back
+    else c->namesGarbage += len;
+    if (row != last) {
+        c->id[row] = c->id[last];
+        c->age[row] = c->age[last];
+        c->marks[row] = c->marks[last];
+        c->nameOffset[row] = c->nameOffset[last];
+    }
+    if (c->count == 0) {
+        columnsClear(c);
+        return;
+    }
+    if (c->namesGarbage < 1024 || 2 * c->namesGarbage < c->namesUsed) return;
+    char *names = malloc(c->namesCapacity);
+    if (!names) return;             // keep the garbage, try again next time
+    int used = 0;
+    for (int i = 0; i < c->count; i++) {
+        int n = (int)strlen(c->names + c->nameOffset[i]) + 1;
+        memcpy(names + used, c->names + c->nameOffset[i], n);
+        c->nameOffset[i] = used;
+        used += n;
+    }
+    free(c->names);
+    c->names = names;
+    c->namesUsed = used;
+    c->namesGarbage = 0;
+}
+
+int columnsFromStore(StudentColumns *c) {
+    columnsClear(c);
+    int n = studentTotal();
+    if (columnsReserve(c, n) != 0) return -1;
+    for (int i = 0; i < n; i++) {
+        if (columnsAppend(c, studentAt(i)) != 0) return -1;
+    }
+    return 0;
+}
+
+Student columnsRow(const StudentColumns *c, int row) {
+    Student s = { .id = c->id[row], .age = c->age[row], .marks = c->marks[row] };
+    strncpy(s.name, c->names + c->nameOffset[row], NAME_LEN - 1);
+    return s;
+}
+
+// Eight independent partial sums: each lane only ever adds its own
+// elements, so the compiler may keep them in vector registers without
+// reordering any additions (no -ffast-math needed).
+double columnsAverage(const StudentColumns *c) {
+    if (c->count == 0) return 0;
+    const float *restrict m = c->marks;
+    int n = c->count, i = 0;
+    double lane[8] = { 0 };
+    for (; i + 8 <= n; i += 8) {
+        for (int j = 0; j < 8; j++) lane[j] += m[i + j];
+    }
+    double sum = 0;
+    for (; i < n; i++) sum += m[i];
+    for (int j = 0; j < 8; j++) sum += lane[j];
+    return sum / n;
+}
+
+int columnsCountWhere(const StudentColumns *c, float minMarks, int maxAge) {
+    const float *restrict m = c->marks;
+    const int *restrict a = c->age;
+    int hits = 0;
+    for (int i = 0; i < c->count; i++) {
+        hits += (m[i] > minMarks) & (a[i] < maxAge);
+    }
+    return hits;
+}
+
+// Branch-free selection: every row index is written, but the output
+// position only advances for matches. out[] needs room for count rows.
+int columnsFilter(const StudentColumns *c, float minMarks, int maxAge, int *out) {
+    const float *restrict m = c->marks;
+    const int *restrict a = c->age;
+    int k = 0;
+    for (int i = 0; i < c->count; i++) {
+        out[k] = i;
+        k += (m[i] > minMarks) & (a[i] < maxAge);
+    }
+    return k;
+}
+
+void filterStudents() {
+    float minMarks;
+    int maxAge;
+    printf("Marks greater than: ");
+    scanf("%f", &minMarks);
+    printf("Age less than: ");
+    scanf("%d", &maxAge);
+
+    const StudentColumns *c = studentColumns();
+    int *rows = c ? malloc((size_t)(c->count + 1) * sizeof(int)) : NULL;
+    if (!rows) {
+        printf("Out of memory.\n");
+        return;
+    }
+    int n = columnsFilter(c, minMarks, maxAge, rows);
+    printf("\n--- %d matching students ---\n", n);
+    for (int i = 0; i < n; i++) {
+        Student s = columnsRow(c, rows[i]);
+        printf("ID: %d, Name: %s, Age: %d, Marks: %.2f\n", s.id, s.name, s.age, s.marks);
+    }
+    free(rows);
+}
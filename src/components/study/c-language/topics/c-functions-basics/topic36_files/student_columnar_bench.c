@@ -0,0 +1,72 @@
+// student_columnar_bench.c – Scanning marks in row vs column layout
+// Build: gcc -O3 student_columnar_bench.c student_columnar.c modular_student_impl.c -o colbench -lm
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "modular_student.h"
+
+static double nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static volatile double sink;
+
+// The same queries over the row store, one Student at a time
+static double rowAverage() {
+    int n = studentTotal();
+    double sum = 0;
+    for (int i = 0; i < n; i++) sum += studentAt(i)->marks;
+    return n ? sum / n : 0;
+}
+
+static int rowCountWhere(float minMarks, int maxAge) {
+    int n = studentTotal(), hits = 0;
+    for (int i = 0; i < n; i++) {
+        const Student *s = studentAt(i);
+        if (s->marks > minMarks && s->age < maxAge) hits++;
+    }
+    return hits;
+}
+
+int main() {
+    const int n = 5000000, rounds = 20;
+    srand(3);
+    Student s = { 0, "Student", 0, 0 };
+    for (int i = 0; i < n; i++) {
+        s.id = i + 1;
+        s.age = 17 + rand() % 10;
+        s.marks = (float)(rand() % 1001) / 10;
+        addRecord(&s);
+    }
+    StudentColumns c;
+    columnsInit(&c);
+    columnsFromStore(&c);
+
+    double t0 = nowNs();
+    for (int r = 0; r < rounds; r++) sink = rowAverage();
+    double rowAvg = (nowNs() - t0) / rounds;
+    t0 = nowNs();
+    for (int r = 0; r < rounds; r++) sink = columnsAverage(&c);
+    double colAvg = (nowNs() - t0) / rounds;
+
+    int hitsRow = 0, hitsCol = 0;
+    t0 = nowNs();
+    for (int r = 0; r < rounds; r++) hitsRow = rowCountWhere(75.0f, 21);
+    double rowFilter = (nowNs() - t0) / rounds;
+    t0 = nowNs();
+    for (int r = 0; r < rounds; r++) hitsCol = columnsCountWhere(&c, 75.0f, 21);
+    double colFilter = (nowNs() - t0) / rounds;
+
+    printf("%d students\n", n);
+    printf("%-28s %10s %10s\n", "", "rows ms", "columns ms");
+    printf("%-28s %10.2f %10.2f   (%.4f / %.4f)\n", "average marks",
+           rowAvg / 1e6, colAvg / 1e6, rowAverage(), columnsAverage(&c));
+    printf("%-28s %10.2f %10.2f   (%d / %d hits)\n", "marks > 75 && age < 21",
+           rowFilter / 1e6, colFilter / 1e6, hitsRow, hitsCol);
+
+    columnsFree(&c);
+    clearStudents();
+    return 0;
+}
@@ -0,0 +1,46 @@
+// student_csv_bench.c – Bulk CSV import speed vs thread count
+// Build: gcc -O2 -pthread student_csv_bench.c student_csv_import.c modular_student_impl.c student_columnar.c -o csvbench -lm
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "modular_student.h"
+
+#define BENCH_CSV "bench_students.csv"
+#define BENCH_TXT "bench_students.txt"
+
+static double nowSec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main() {
+    const int rows = 5000000;
+    srand(11);
+    FILE *fp = fopen(BENCH_CSV, "w");
+    if (!fp) { printf("Cannot create %s\n", BENCH_CSV); return 1; }
+    fprintf(fp, "id,name,age,marks\n");
+    for (int i = 1; i <= rows; i++) {
+        fprintf(fp, "%d,Student %d,%d,%.2f\n", i, i, 17 + rand() % 10, (rand() % 10001) / 100.0);
+    }
+    fclose(fp);
+
+    // The same rows in the text format, for the fgets/sscanf importer
+    importCsv(BENCH_CSV, 1);
+    exportText(BENCH_TXT);
+    clearStudents();
+    double t0 = nowSec();
+    int n = importText(BENCH_TXT);
+    double t = nowSec() - t0;
+    printf("importText: %d rows in %.3f s: %.0f rows/s\n\n", n, t, n / t);
+
+    const int threadCounts[] = { 1, 2, 4, 8 };
+    for (int k = 0; k < 4; k++) {
+        clearStudents();
+        importCsv(BENCH_CSV, threadCounts[k]);
+    }
+    printf("\n%d students loaded, average marks %.4f\n", studentTotal(), averageMarks());
+    remove(BENCH_CSV);
+    remove(BENCH_TXT);
+    return 0;
+}
@@ -0,0 +1,228 @@
+// student_csv_import.c – Multi-threaded bulk import of student CSV files
+// The file is memory-mapped and cut into one chunk per thread at line
+// boundaries. Each thread parses its chunk with a hand-written parser
+// (no scanf, no locale, no copying lines) into its own record buffer,
+// and the buffers are added to the store in file order at the end.
+// Build with -pthread.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "modular_student.h"
+
+#define MAX_IMPORT_THREADS 64
+
+typedef struct {
+    const char *begin, *end;    // whole lines only
+    Student *recs;
+    int count, capacity;
+    long badLines;
+    int failed;                 // out of memory
+} ImportChunk;
+
+static const char* skipSpaces(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    return p;
+}
+
+// Optional sign and digits. Returns NULL if there are no digits.
+static const char* parseInt(const char *p, const char *end, int *out) {
+    p = skipSpaces(p, end);
+    int neg = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+')) p++;
+    const char *digits = p;
+    unsigned v = 0;
+    while (p < end && (unsigned)(*p - '0') < 10) v = v * 10 + (unsigned)(*p++ - '0');
+    if (p == digits) return NULL;
+    *out = neg ? (int)(0u - v) : (int)v;
+    return skipSpaces(p, end);
+}
+
+// Decimal number like "87", "-3.5" or "99.25". The digits are gathered
+// into one integer and scaled once at the end.
+static const char* parseMarks(const char *p, const char *end, float *out) {
+    static const double scale[] = { 1, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9 };
+    p = skipSpaces(p, end);
+    int neg = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+')) p++;
+    const char *start = p;
+    unsigned long long v = 0;
+    int fraction = 0;
+    while (p < end && (unsigned)(*p - '0') < 10) v = v * 10 + (unsigned)(*p++ - '0');
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && (unsigned)(*p - '0') < 10) {
+            if (fraction < 9) { v = v * 10 + (unsigned)(*p - '0'); fraction++; }
+            p++;
+        }
+    }
+    if (p == start) return NULL;
+    double d = (double)v * scale[fraction];
+    *out = (float)(neg ? -d : d);
+    return skipSpaces(p, end);
+}
+
+// Name field, optionally "quoted" with "" for a literal quote.
+// Longer names are cut to NAME_LEN - 1 characters.
+static const char* parseName(const char *p, const char *end, char *name) {
+    int n = 0;
+    p = skipSpaces(p, end);
+    if (p < end && *p == '"') {
+        for (p++; p < end; p++) {
+            if (*p == '"') {
+                if (p + 1 < end && p[1] == '"') p++;
+                else { p++; break; }
+            }
+            if (n < NAME_LEN - 1) name[n++] = *p;
+        }
+        p = skipSpaces(p, end);
+    } else {
+        const char *comma = memchr(p, ',', (size_t)(end - p));
+        const char *stop = comma ? comma : end;
+        while (stop > p && stop[-1] == ' ') stop--;
+        n = (int)(stop - p < NAME_LEN - 1 ? stop - p : NAME_LEN - 1);
+        memcpy(name, p, (size_t)n);
+        p = comma ? comma : end;
+    }
+    name[n] = '\0';
+    return p;
+}
+
+static int parseCsvLine(const char *p, const char *end, Student *s) {
+    if (!(p = parseInt(p, end, &s->id)) || p == end || *p++ != ',') return 0;
+    if (!(p = parseName(p, end, s->name)) || p == end || *p++ != ',') return 0;
+    if (!(p = parseInt(p, end, &s->age)) || p == end || *p++ != ',') return 0;
+    if (!(p = parseMarks(p, end, &s->marks))) return 0;
+    return p == end;
+}
+
+static void* parseChunk(void *arg) {
+    ImportChunk *c = arg;
+    const char *p = c->begin;
+    while (p < c->end) {
+        const char *nl = memchr(p, '\n', (size_t)(c->end - p));
+        const char *lineEnd = nl ? nl : c->end;
+        const char *next = nl ? nl + 1 : c->end;
+        if (lineEnd > p && lineEnd[-1] == '\r') lineEnd--;
+        if (lineEnd == p) { p = next; continue; }       // blank line
+
+        if (c->count == c->capacity) {
+            int cap = c->capacity ? c->capacity * 2 : 4096;
+            Student *tmp = realloc(c->recs, (size_t)cap * sizeof(Student));
+            if (!tmp) { c->failed = 1; return NULL; }
+            c->recs = tmp;
+            c->capacity = cap;
+        }
+        Student *s = &c->recs[c->count];
+        memset(s, 0, sizeof *s);
+        if (parseCsvLine(p, lineEnd, s)) c->count++;
+        else c->badLines++;
+        p = next;
+    }
+    return NULL;
+}
+
+static double nowSec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int importCsv(const char *path, int threads) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0) { close(fd); return -1; }
+    if (st.st_size == 0) { close(fd); return 0; }
+    const char *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return -1;
+    madvise((void*)data, st.st_size, MADV_SEQUENTIAL);
+    const char *end = data + st.st_size;
+    double t0 = nowSec();
+
+    // A first line starting with a letter is a column header
+    const char *start = data;
+    const char *first = skipSpaces(data, end);
+    if (first < end && (*first < '0' || *first > '9') && *first != '-' && *first != '+') {
+        const char *nl = memchr(start, '\n', (size_t)(end - start));
+        start = nl ? nl + 1 : end;
+    }
+
+    if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) threads = 1;
+    if (threads > MAX_IMPORT_THREADS) threads = MAX_IMPORT_THREADS;
+    size_t minChunk = 1 << 20;          // not worth a thread below 1 MB
+    if ((size_t)(end - start) / minChunk + 1 < (size_t)threads)
+        threads = (int)((size_t)(end - start) / minChunk + 1);
+
+    // Equal-sized chunks, each moved forward to just past a newline
+    ImportChunk chunks[MAX_IMPORT_THREADS];
+    memset(chunks, 0, sizeof chunks);
+    const char *cut = start;
+    for (int t = 0; t < threads; t++) {
+        chunks[t].begin = cut;
+        if (t == threads - 1) {
+            cut = end;
+        } else {
+            cut = start + (size_t)(end - start) * (t + 1) / threads;
+            if (cut < chunks[t].begin) cut = chunks[t].begin;
+            const char *nl = memchr(cut, '\n', (size_t)(end - cut));
+            cut = nl ? nl + 1 : end;
+        }
+        chunks[t].end = cut;
+    }
+
+    pthread_t tid[MAX_IMPORT_THREADS];
+    int started[MAX_IMPORT_THREADS] = { 0 };
+    for (int t = 1; t < threads; t++) {
+        started[t] = pthread_create(&tid[t], NULL, parseChunk, &chunks[t]) == 0;
+        if (!started[t]) parseChunk(&chunks[t]);        // no thread: parse here
+    }
+    parseChunk(&chunks[0]);
+    for (int t = 1; t < threads; t++) {
+        if (started[t]) pthread_join(tid[t], NULL);
+    }
+    double tParsed = nowSec();
+
+    // Concatenate in file order, so "first id wins" as with importText
+    long rows = 0, bad = 0;
+    int added = 0, failed = 0;
+    for (int t = 0; t < threads; t++) {
+        rows += chunks[t].count;
+        bad += chunks[t].badLines;
+        failed |= chunks[t].failed;
+    }
+    if (!failed) {
+        for (int t = 0; t < threads; t++) {
+            int n = addRecords(chunks[t].recs, chunks[t].count);
+            if (n < 0) { failed = 1; break; }
+            added += n;
+        }
+    }
+    for (int t = 0; t < threads; t++) free(chunks[t].recs);
+    munmap((void*)data, st.st_size);
+    if (failed) return -1;
+
+    double tDone = nowSec();
+    printf("Parsed %ld rows (%ld bad) with %d thread%s in %.3f s: %.0f rows/s "
+           "(%.0f rows/s including store insert)\n",
+           rows, bad, threads, threads == 1 ? "" : "s", tParsed - t0,
+           rows / (tParsed - t0 > 0 ? tParsed - t0 : 1e-9),
+           rows / (tDone - t0 > 0 ? tDone - t0 : 1e-9));
+    return added;
+}
+
+void bulkImport() {
+    char path[256];
+    printf("CSV file: ");
+    if (scanf(" %255[^\n]", path) != 1) return;
+    int n = importCsv(path, 0);
+    if (n < 0) printf("Error importing %s!\n", path);
+    else printf("Added %d students.\n", n);
+}
@@ -0,0 +1,72 @@
+// student_index_bench.c – Lookup latency of the hash index vs a linear scan
+// Build: gcc -O2 student_index_bench.c modular_student_impl.c student_columnar.c -o bench -lm
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "modular_student.h"
+
+static double nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Random 31-bit number (rand() alone may only give 15 bits)
+static int randomInt() {
+    return ((rand() & 0x7FFF) << 16) ^ ((rand() & 0x7FFF) << 1) ^ (rand() & 1);
+}
+
+static const Student* linearSearch(int id) {
+    int n = studentTotal();
+    for (int i = 0; i < n; i++) {
+        if (studentAt(i)->id == id) return studentAt(i);
+    }
+    return NULL;
+}
+
+int main() {
+    const int sizes[] = { 1000, 1000000, 10000000 };
+    const int lookups = 1000000;
+    srand(7);
+
+    printf("%10s %16s %16s\n", "records", "hash ns/lookup", "scan ns/lookup");
+    for (int k = 0; k < 3; k++) {
+        int n = sizes[k];
+        clearStudents();
+        // Shuffled, sparse ids so the index can't rely on them being dense
+        // or arriving in order
+        int *ids = malloc(n * sizeof(int));
+        if (!ids) return 1;
+        for (int i = 0; i < n; i++) ids[i] = i * 7 + 13;
+        for (int i = n - 1; i > 0; i--) {        // Fisher-Yates
+            int j = randomInt() % (i + 1);
+            int t = ids[i];
+            ids[i] = ids[j];
+            ids[j] = t;
+        }
+        Student s = { 0, "Student", 20, 50.0f };
+        for (int i = 0; i < n; i++) {
+            s.id = ids[i];
+            addRecord(&s);
+        }
+        free(ids);
+
+        int *queries = malloc(lookups * sizeof(int));
+        for (int i = 0; i < lookups; i++) queries[i] = (randomInt() % n) * 7 + 13;
+
+        long found = 0;
+        double t0 = nowNs();
+        for (int i = 0; i < lookups; i++) found += findById(queries[i]) != NULL;
+        double hashNs = (nowNs() - t0) / lookups;
+
+        // A linear scan is O(n), so only sample a few lookups on big tables
+        int scans = n <= 1000 ? lookups : 200;
+        t0 = nowNs();
+        for (int i = 0; i < scans; i++) found += linearSearch(queries[i]) != NULL;
+        double scanNs = (nowNs() - t0) / scans;
+
+        printf("%10d %16.1f %16.1f   (%ld found)\n", n, hashNs, scanNs, found);
+        free(queries);
+    }
+    return 0;
+}
@@ -1,44 +1,273 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
-void merge(int arr[], int l, int m, int r) {
-    int n1 = m - l + 1;
-    int n2 = r - m;
-    int *L = (int*)malloc(n1 * sizeof(int));
-    int *R = (int*)malloc(n2 * sizeof(int));
-    for (int i = 0; i < n1; i++) L[i] = arr[l + i];
-    for (int j = 0; j < n2; j++) R[j] = arr[m + 1 + j];
-    int i = 0, j = 0, k = l;
-    while (i < n1 && j < n2) {
-        if (L[i] <= R[j]) arr[k++] = L[i++];
-        else arr[k++] = R[j++];
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
+// Buffered output: numbers are formatted by hand into outBuf, and the
+// buffer leaves with a single write() when it fills or on flushOut(),
+// instead of one printf call (format parsing + stream lock) per number.
+static char outBuf[1 << 16];
+static size_t outLen;
+
+static void writeAll(const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t w = write(STDOUT_FILENO, p, len);
+        if (w <= 0) return;
+        p += w;
+        len -= (size_t)w;
+    }
+}
+
+// Text printed with printf is still in stdout's own buffer: it goes first
+static void flushOut(void) {
+    fflush(stdout);
+    writeAll(outBuf, outLen);
+    outLen = 0;
+}
+
+static void writeBytes(const char *s, size_t len) {
+    if (len > sizeof outBuf - outLen) {
+        flushOut();
+        if (len > sizeof outBuf) {
+            writeAll(s, len);
+            return;
+        }
+    }
+    memcpy(outBuf + outLen, s, len);
+    outLen += len;
+}
+
+static void writeChar(char c) {
+    if (outLen == sizeof outBuf) flushOut();
+    outBuf[outLen++] = c;
+}
+
+// "00" "01" ... "99": two digits per division by 100
+static const char DIGIT_PAIRS[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Formats v backwards so that it ends just before 'end'; returns its start
+static char* formatInt(char *end, int v) {
+    char *p = end;
+    unsigned u = v < 0 ? 0u - (unsigned)v : (unsigned)v;
+    while (u >= 100) {
+        unsigned r = u % 100;
+        u /= 100;
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * r, 2);
+    }
+    if (u >= 10) {
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * u, 2);
+    } else {
+        *--p = (char)('0' + u);
     }
-    while (i < n1) arr[k++] = L[i++];
-    while (j < n2) arr[k++] = R[j++];
-    free(L); free(R);
+    if (v < 0) *--p = '-';
+    return p;
 }
 
+static void writeInt(int v) {
+    char tmp[12];
+    char *p = formatInt(tmp + sizeof tmp, v);
+    writeBytes(p, (size_t)(tmp + sizeof tmp - p));
+}
+
+#define MIN_RUN 32      // shorter runs are topped up with insertion sort
+
+// Sorts arr[lo..hi) given that arr[lo..start) is already sorted. Binary
+// search finds each slot; inserting after equal keys keeps it stable.
+static void binaryInsertionSort(int arr[], int lo, int start, int hi) {
+    for (int i = start; i < hi; i++) {
+        int x = arr[i], left = lo, right = i;
+        while (left < right) {
+            int mid = left + (right - left) / 2;
+            if (x < arr[mid]) right = mid;
+            else left = mid + 1;
+        }
+        memmove(&arr[left + 1], &arr[left], (size_t)(i - left) * sizeof(int));
+        arr[left] = x;
+    }
+}
+
+// Length of the natural run starting at lo. A strictly descending run is
+// reversed in place (strictly, so equal keys never change order).
+static int countRun(int arr[], int lo, int hi) {
+    int end = lo + 1;
+    if (end == hi) return 1;
+    if (arr[end] < arr[lo]) {
+        while (end + 1 < hi && arr[end + 1] < arr[end]) end++;
+        for (int i = lo, j = end; i < j; i++, j--) {
+            int t = arr[i];
+            arr[i] = arr[j];
+            arr[j] = t;
+        }
+    } else {
+        while (end + 1 < hi && arr[end + 1] >= arr[end]) end++;
+    }
+    return end - lo + 1;
+}
+
+// Galloping: probe 1, 3, 7, 15, ... elements in, then binary search the
+// last gap. Cheap when the answer is near the starting end.
+// First index in arr[lo..hi) holding a value > key:
+static int gallopRight(int key, const int arr[], int lo, int hi) {
+    int prev = lo, step = 1;
+    while (lo + step - 1 < hi && arr[lo + step - 1] <= key) {
+        prev = lo + step;
+        step *= 2;
+    }
+    int right = lo + step - 1 < hi ? lo + step - 1 : hi;
+    while (prev < right) {
+        int mid = prev + (right - prev) / 2;
+        if (arr[mid] <= key) prev = mid + 1;
+        else right = mid;
+    }
+    return prev;
+}
+
+// ... and first index in arr[lo..hi) holding a value >= key, probing from hi
+static int gallopLeftFromEnd(int key, const int arr[], int lo, int hi) {
+    int next = hi, step = 1;
+    while (hi - step >= lo && arr[hi - step] >= key) {
+        next = hi - step;
+        step *= 2;
+    }
+    int left = hi - step >= lo ? hi - step + 1 : lo;
+    while (left < next) {
+        int mid = left + (next - left) / 2;
+        if (arr[mid] >= key) next = mid;
+        else left = mid + 1;
+    }
+    return next;
+}
+
+// Merges the sorted runs arr[lo..mid) and arr[mid..hi). The start of the
+// left run that is <= everything on the right, and the end of the right
+// run that is >= everything on the left, are already in place and found
+// by galloping; only the smaller of the remaining parts is copied to buf.
+static void merge(int arr[], int lo, int mid, int hi, int *buf) {
+    if (arr[mid - 1] <= arr[mid]) return;       // already in order
+    lo = gallopRight(arr[mid], arr, lo, mid);
+    hi = gallopLeftFromEnd(arr[mid - 1], arr, mid, hi);
+    int n1 = mid - lo, n2 = hi - mid;
+    if (n1 <= n2) {
+        memcpy(buf, &arr[lo], (size_t)n1 * sizeof(int));
+        int i = 0, j = mid, k = lo;
+        while (i < n1 && j < hi) arr[k++] = (arr[j] < buf[i]) ? arr[j++] : buf[i++];
+        while (i < n1) arr[k++] = buf[i++];
+    } else {
+        memcpy(buf, &arr[mid], (size_t)n2 * sizeof(int));
+        int i = mid - 1, j = n2 - 1, k = hi - 1;
+        while (i >= lo && j >= 0) arr[k--] = (buf[j] < arr[i]) ? arr[i--] : buf[j--];
+        while (j >= 0) arr[k--] = buf[j--];
+    }
+}
+
+// Stable natural merge sort of arr[l..r]: split into ascending runs
+// (at least MIN_RUN long), then merge neighbouring runs pass by pass.
+// Sorted or reversed input is a single run and costs one scan.
 void mergeSort(int arr[], int l, int r) {
-    if (l < r) {
-        int m = l + (r - l) / 2;
-        mergeSort(arr, l, m);
-        mergeSort(arr, m+1, r);
-        merge(arr, l, m, r);
+    arr += l;
+    int n = r - l + 1;
+    if (n < 2) return;
+    // One allocation: n/2 merge buffer, then the list of run starts
+    int *buf = malloc((size_t)(n / 2 + 1 + n / MIN_RUN + 2) * sizeof(int));
+    if (!buf) {
+        binaryInsertionSort(arr, 0, 1, n);
+        return;
+    }
+    int *runs = buf + n / 2 + 1, count = 0;
+    for (int lo = 0; lo < n; ) {
+        int len = countRun(arr, lo, n);
+        if (len < MIN_RUN) {
+            int end = lo + MIN_RUN < n ? lo + MIN_RUN : n;
+            binaryInsertionSort(arr, lo, lo + len, end);
+            len = end - lo;
+        }
+        runs[count++] = lo;
+        lo += len;
     }
+    runs[count] = n;
+
+    while (count > 1) {
+        int kept = 0;
+        for (int i = 0; i < count; i += 2) {
+            if (i + 1 < count) merge(arr, runs[i], runs[i + 1], runs[i + 2], buf);
+            runs[kept++] = runs[i];
+        }
+        runs[kept] = n;
+        count = kept;
+    }
+    free(buf);
 }
 
 int main() {
-    int n;
+    int n = 0;
     printf("Enter size: ");
-    scanf("%d", &n);
-    int arr[n];
+    if (!readInt(&n)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Enter elements: ");
-    for (int i = 0; i < n; i++) scanf("%d", &arr[i]);
+    int *arr = readInts(&n);
 
     mergeSort(arr, 0, n-1);
 
     printf("Sorted array: ");
-    for (int i = 0; i < n; i++) printf("%d ", arr[i]);
-    printf("\n");
+    for (int i = 0; i < n; i++) { writeInt(arr[i]); writeChar(' '); }
+    writeChar('\n');
+    flushOut();
+    free(arr);
     return 0;
 }
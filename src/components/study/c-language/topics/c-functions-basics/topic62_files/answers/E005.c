@@ -1,42 +1,286 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
 
-// Counting sort for a specific digit (exp = 10^d)
-void countingSortRadix(int arr[], int n, int exp) {
-    int output[n];
-    int count[10] = {0};
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
 
-    for (int i = 0; i < n; i++) count[(arr[i] / exp) % 10]++;
-    for (int i = 1; i < 10; i++) count[i] += count[i-1];
-    for (int i = n-1; i >= 0; i--) {
-        int digit = (arr[i] / exp) % 10;
-        output[count[digit] - 1] = arr[i];
-        count[digit]--;
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
     }
-    for (int i = 0; i < n; i++) arr[i] = output[i];
+    return (unsigned char)inBuf[inPos++];
 }
 
-void radixSort(int arr[], int n) {
-    int max = arr[0];
-    for (int i = 1; i < n; i++)
-        if (arr[i] > max) max = arr[i];
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
+// Buffered output: numbers are formatted by hand into outBuf, and the
+// buffer leaves with a single write() when it fills or on flushOut(),
+// instead of one printf call (format parsing + stream lock) per number.
+static char outBuf[1 << 16];
+static size_t outLen;
+
+static void writeAll(const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t w = write(STDOUT_FILENO, p, len);
+        if (w <= 0) return;
+        p += w;
+        len -= (size_t)w;
+    }
+}
+
+// Text printed with printf is still in stdout's own buffer: it goes first
+static void flushOut(void) {
+    fflush(stdout);
+    writeAll(outBuf, outLen);
+    outLen = 0;
+}
+
+static void writeBytes(const char *s, size_t len) {
+    if (len > sizeof outBuf - outLen) {
+        flushOut();
+        if (len > sizeof outBuf) {
+            writeAll(s, len);
+            return;
+        }
+    }
+    memcpy(outBuf + outLen, s, len);
+    outLen += len;
+}
+
+static void writeChar(char c) {
+    if (outLen == sizeof outBuf) flushOut();
+    outBuf[outLen++] = c;
+}
+
+// "00" "01" ... "99": two digits per division by 100
+static const char DIGIT_PAIRS[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Formats v backwards so that it ends just before 'end'; returns its start
+static char* formatInt(char *end, int v) {
+    char *p = end;
+    unsigned u = v < 0 ? 0u - (unsigned)v : (unsigned)v;
+    while (u >= 100) {
+        unsigned r = u % 100;
+        u /= 100;
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * r, 2);
+    }
+    if (u >= 10) {
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * u, 2);
+    } else {
+        *--p = (char)('0' + u);
+    }
+    if (v < 0) *--p = '-';
+    return p;
+}
 
-    for (int exp = 1; max / exp > 0; exp *= 10)
-        countingSortRadix(arr, n, exp);
+static void writeInt(int v) {
+    char tmp[12];
+    char *p = formatInt(tmp + sizeof tmp, v);
+    writeBytes(p, (size_t)(tmp + sizeof tmp - p));
+}
+
+// LSD radix sort on bytes: 4 passes for 32-bit keys and 8 for 64-bit
+// ones, whatever the values, instead of one pass per decimal digit.
+// The histograms of every byte position come from a single read of the
+// keys, and a pass is skipped when all keys share that byte (small
+// values never pay for their high bytes). Signed and float keys are
+// mapped to unsigned ones that sort the same way. All sorts are stable.
+#define RADIX_BITS 8
+#define RADIX_SIZE (1 << RADIX_BITS)
+#define RADIX_MASK (RADIX_SIZE - 1)
+
+// Turns counts into start offsets; returns 0 if every key has the digit
+// 'common', i.e. the pass wouldn't move anything
+static int prefixSums(size_t count[RADIX_SIZE], size_t n, unsigned common) {
+    if (count[common] == n) return 0;
+    size_t sum = 0;
+    for (int d = 0; d < RADIX_SIZE; d++) {
+        size_t c = count[d];
+        count[d] = sum;
+        sum += c;
+    }
+    return 1;
+}
+
+// Sorts keys[0..n) using tmp (also n long) as the other buffer
+static void radixSortU32(uint32_t *keys, uint32_t *tmp, size_t n) {
+    enum { PASSES = 32 / RADIX_BITS };
+    if (n < 2) return;
+    size_t count[PASSES][RADIX_SIZE] = {{0}};
+    for (size_t i = 0; i < n; i++)
+        for (int p = 0; p < PASSES; p++) count[p][(keys[i] >> (p * RADIX_BITS)) & RADIX_MASK]++;
+
+    uint32_t *src = keys, *dst = tmp;
+    for (int p = 0; p < PASSES; p++) {
+        int shift = p * RADIX_BITS;
+        if (!prefixSums(count[p], n, (src[0] >> shift) & RADIX_MASK)) continue;
+        for (size_t i = 0; i < n; i++) dst[count[p][(src[i] >> shift) & RADIX_MASK]++] = src[i];
+        uint32_t *t = src; src = dst; dst = t;
+    }
+    if (src != keys) memcpy(keys, src, n * sizeof(uint32_t));
+}
+
+static void radixSortU64(unsigned long long *keys, unsigned long long *tmp, size_t n) {
+    enum { PASSES = 64 / RADIX_BITS };
+    if (n < 2) return;
+    size_t count[PASSES][RADIX_SIZE] = {{0}};
+    for (size_t i = 0; i < n; i++)
+        for (int p = 0; p < PASSES; p++) count[p][(keys[i] >> (p * RADIX_BITS)) & RADIX_MASK]++;
+
+    unsigned long long *src = keys, *dst = tmp;
+    for (int p = 0; p < PASSES; p++) {
+        int shift = p * RADIX_BITS;
+        if (!prefixSums(count[p], n, (unsigned)(src[0] >> shift) & RADIX_MASK)) continue;
+        for (size_t i = 0; i < n; i++) dst[count[p][(src[i] >> shift) & RADIX_MASK]++] = src[i];
+        unsigned long long *t = src; src = dst; dst = t;
+    }
+    if (src != keys) memcpy(keys, src, n * sizeof(unsigned long long));
+}
+
+// Signed ints: flipping the sign bit puts negatives first as unsigned.
+// Returns 0, or -1 if the scratch buffer can't be allocated.
+int radixSortInts(int arr[], size_t n) {
+    if (n < 2) return 0;
+    uint32_t *keys = (uint32_t*)arr, *tmp = malloc(n * sizeof(uint32_t));
+    if (!tmp) return -1;
+    for (size_t i = 0; i < n; i++) keys[i] ^= 0x80000000u;
+    radixSortU32(keys, tmp, n);
+    for (size_t i = 0; i < n; i++) keys[i] ^= 0x80000000u;
+    free(tmp);
+    return 0;
+}
+
+int radixSortInt64(long long arr[], size_t n) {
+    if (n < 2) return 0;
+    unsigned long long *keys = (unsigned long long*)arr, *tmp = malloc(n * sizeof(unsigned long long));
+    if (!tmp) return -1;
+    for (size_t i = 0; i < n; i++) keys[i] ^= 0x8000000000000000ull;
+    radixSortU64(keys, tmp, n);
+    for (size_t i = 0; i < n; i++) keys[i] ^= 0x8000000000000000ull;
+    free(tmp);
+    return 0;
+}
+
+// IEEE floats: positives get the sign bit set, negatives are inverted
+// (larger magnitude = smaller value). -0.0 lands before +0.0 and NaNs at
+// the ends, by their sign.
+int radixSortFloats(float arr[], size_t n) {
+    if (n < 2) return 0;
+    uint32_t *keys = malloc(2 * n * sizeof(uint32_t));
+    if (!keys) return -1;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t b;
+        memcpy(&b, &arr[i], sizeof b);
+        keys[i] = (b & 0x80000000u) ? ~b : b ^ 0x80000000u;
+    }
+    radixSortU32(keys, keys + n, n);
+    for (size_t i = 0; i < n; i++) {
+        uint32_t b = (keys[i] & 0x80000000u) ? keys[i] ^ 0x80000000u : ~keys[i];
+        memcpy(&arr[i], &b, sizeof b);
+    }
+    free(keys);
+    return 0;
+}
+
+// Key + payload: sorts n records of 'size' bytes by the int stored at
+// keyOffset inside each record, moving whole records. Stable, so sorting
+// by a second key and then by a first one orders by (first, second).
+int radixSortRecords(void *base, size_t n, size_t size, size_t keyOffset) {
+    enum { PASSES = 32 / RADIX_BITS };
+    if (n < 2) return 0;
+    char *tmp = malloc(n * size);
+    if (!tmp) return -1;
+    size_t count[PASSES][RADIX_SIZE] = {{0}};
+    for (size_t i = 0; i < n; i++) {
+        uint32_t k;
+        memcpy(&k, (char*)base + i * size + keyOffset, sizeof k);
+        k ^= 0x80000000u;
+        for (int p = 0; p < PASSES; p++) count[p][(k >> (p * RADIX_BITS)) & RADIX_MASK]++;
+    }
+
+    char *src = base, *dst = tmp;
+    for (int p = 0; p < PASSES; p++) {
+        int shift = p * RADIX_BITS;
+        uint32_t k0;
+        memcpy(&k0, src + keyOffset, sizeof k0);
+        if (!prefixSums(count[p], n, ((k0 ^ 0x80000000u) >> shift) & RADIX_MASK)) continue;
+        for (size_t i = 0; i < n; i++) {
+            uint32_t k;
+            memcpy(&k, src + i * size + keyOffset, sizeof k);
+            memcpy(dst + count[p][((k ^ 0x80000000u) >> shift) & RADIX_MASK]++ * size, src + i * size, size);
+        }
+        char *t = src; src = dst; dst = t;
+    }
+    if (src != (char*)base) memcpy(base, src, n * size);
+    free(tmp);
+    return 0;
+}
+
+void radixSort(int arr[], int n) {
+    if (n > 1) radixSortInts(arr, (size_t)n);
 }
 
 int main() {
-    int n;
+    int n = 0;
     printf("Enter size: ");
-    scanf("%d", &n);
-    int arr[n];
+    if (!readInt(&n)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Enter elements: ");
-    for (int i = 0; i < n; i++) scanf("%d", &arr[i]);
+    int *arr = readInts(&n);
 
     radixSort(arr, n);
 
     printf("Sorted array: ");
-    for (int i = 0; i < n; i++) printf("%d ", arr[i]);
-    printf("\n");
+    for (int i = 0; i < n; i++) { writeInt(arr[i]); writeChar(' '); }
+    writeChar('\n');
+    flushOut();
+    free(arr);
     return 0;
 }
@@ -1,6 +1,56 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <limits.h>
 
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
 double findMedianSortedArrays(int nums1[], int m, int nums2[], int n) {
     if (m > n) return findMedianSortedArrays(nums2, n, nums1, m);
     int low = 0, high = m;
@@ -29,20 +79,27 @@ double findMedianSortedArrays(int nums1[], int m, int nums2[], int n) {
 }
 
 int main() {
-    int m, n;
+    int m = 0, n = 0;
     printf("Enter size of first array: ");
-    scanf("%d", &m);
-    int arr1[m];
+    if (!readInt(&m)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Enter elements of first sorted array: ");
-    for (int i = 0; i < m; i++) scanf("%d", &arr1[i]);
+    int *arr1 = readInts(&m);
 
     printf("Enter size of second array: ");
-    scanf("%d", &n);
-    int arr2[n];
+    if (!readInt(&n)) {
+        printf("Invalid input.\n");
+        free(arr1);
+        return 1;
+    }
     printf("Enter elements of second sorted array: ");
-    for (int i = 0; i < n; i++) scanf("%d", &arr2[i]);
+    int *arr2 = readInts(&n);
 
     double med = findMedianSortedArrays(arr1, m, arr2, n);
     printf("Median = %g\n", med);
+    free(arr1);
+    free(arr2);
     return 0;
 }
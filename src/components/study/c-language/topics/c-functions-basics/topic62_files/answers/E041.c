@@ -1,45 +1,109 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 
-bool dfs(char board[][100], int m, int n, int i, int j, char *word, int pos) {
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Like scanf(" %c", c): the next character that isn't white space
+static int readChar(char *c) {
+    int ch = nextChar();
+    while (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r') ch = nextChar();
+    if (ch == EOF) return 0;
+    *c = (char)ch;
+    return 1;
+}
+
+// Like scanf("%s", word) but never writes more than size bytes
+static int readWord(char *word, int size) {
+    int ch = nextChar(), len = 0;
+    while (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r') ch = nextChar();
+    while (ch != EOF && ch != ' ' && ch != '\n' && ch != '\t' && ch != '\r') {
+        if (len < size - 1) word[len++] = (char)ch;
+        ch = nextChar();
+    }
+    word[len] = '\0';
+    return len > 0;
+}
+
+bool dfs(int m, int n, char board[][n], int i, int j, char *word, int pos) {
     if (pos == strlen(word)) return true;
     if (i < 0 || i >= m || j < 0 || j >= n || board[i][j] != word[pos]) return false;
     char temp = board[i][j];
     board[i][j] = '#';
-    bool found = dfs(board, m, n, i+1, j, word, pos+1) ||
-                 dfs(board, m, n, i-1, j, word, pos+1) ||
-                 dfs(board, m, n, i, j+1, word, pos+1) ||
-                 dfs(board, m, n, i, j-1, word, pos+1);
+    bool found = dfs(m, n, board, i+1, j, word, pos+1) ||
+                 dfs(m, n, board, i-1, j, word, pos+1) ||
+                 dfs(m, n, board, i, j+1, word, pos+1) ||
+                 dfs(m, n, board, i, j-1, word, pos+1);
     board[i][j] = temp;
     return found;
 }
 
-bool exist(char board[][100], int m, int n, char *word) {
+bool exist(int m, int n, char board[][n], char *word) {
     for (int i = 0; i < m; i++)
         for (int j = 0; j < n; j++)
-            if (board[i][j] == word[0] && dfs(board, m, n, i, j, word, 0))
+            if (board[i][j] == word[0] && dfs(m, n, board, i, j, word, 0))
                 return true;
     return false;
 }
 
 int main() {
-    int m, n;
+    int m = 0, n = 0;
     printf("Enter rows and cols: ");
-    scanf("%d %d", &m, &n);
-    char board[100][100];
+    if (!readInt(&m) || !readInt(&n)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
+    if (m <= 0 || n <= 0) {
+        printf("Invalid size.\n");
+        return 1;
+    }
+    char (*board)[n] = malloc(m * sizeof *board);
+    if (!board) {
+        printf("Memory allocation failed\n");
+        return 1;
+    }
     printf("Board:\n");
     for (int i = 0; i < m; i++)
         for (int j = 0; j < n; j++)
-            scanf(" %c", &board[i][j]); // space to consume newline
+            readChar(&board[i][j]);     // skips the newlines
 
     char word[100];
     printf("Word: ");
-    scanf("%s", word);
+    readWord(word, sizeof word);
 
-    if (exist(board, m, n, word))
+    if (exist(m, n, board, word))
         printf("Word found: Yes\n");
     else
         printf("Word found: No\n");
+    free(board);
     return 0;
 }
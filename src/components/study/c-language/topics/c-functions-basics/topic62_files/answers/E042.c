@@ -1,21 +1,61 @@
 #include <stdio.h>
+#include <stdlib.h>
 
-void dfs(char grid[][100], int m, int n, int i, int j) {
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Like scanf(" %c", c): the next character that isn't white space
+static int readChar(char *c) {
+    int ch = nextChar();
+    while (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r') ch = nextChar();
+    if (ch == EOF) return 0;
+    *c = (char)ch;
+    return 1;
+}
+
+void dfs(int m, int n, char grid[][n], int i, int j) {
     if (i < 0 || i >= m || j < 0 || j >= n || grid[i][j] != '1') return;
     grid[i][j] = '0';
-    dfs(grid, m, n, i+1, j);
-    dfs(grid, m, n, i-1, j);
-    dfs(grid, m, n, i, j+1);
-    dfs(grid, m, n, i, j-1);
+    dfs(m, n, grid, i+1, j);
+    dfs(m, n, grid, i-1, j);
+    dfs(m, n, grid, i, j+1);
+    dfs(m, n, grid, i, j-1);
 }
 
-int numIslands(char grid[][100], int m, int n) {
+int numIslands(int m, int n, char grid[][n]) {
     int count = 0;
     for (int i = 0; i < m; i++) {
         for (int j = 0; j < n; j++) {
             if (grid[i][j] == '1') {
                 count++;
-                dfs(grid, m, n, i, j);
+                dfs(m, n, grid, i, j);
             }
         }
     }
@@ -23,16 +63,28 @@ int numIslands(char grid[][100], int m, int n) {
 }
 
 int main() {
-    int m, n;
+    int m = 0, n = 0;
     printf("Enter rows and cols: ");
-    scanf("%d %d", &m, &n);
-    char grid[100][100];
+    if (!readInt(&m) || !readInt(&n)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
+    if (m <= 0 || n <= 0) {
+        printf("Invalid size.\n");
+        return 1;
+    }
+    char (*grid)[n] = malloc(m * sizeof *grid);
+    if (!grid) {
+        printf("Memory allocation failed\n");
+        return 1;
+    }
     printf("Grid:\n");
     for (int i = 0; i < m; i++)
         for (int j = 0; j < n; j++)
-            scanf(" %c", &grid[i][j]);
+            readChar(&grid[i][j]);
 
-    int islands = numIslands(grid, m, n);
+    int islands = numIslands(m, n, grid);
     printf("Number of islands = %d\n", islands);
+    free(grid);
     return 0;
 }
@@ -1,13 +1,77 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
+// Read an r x c matrix into one heap block. Use it through a pointer to
+// a row so m[i][j] still works: int (*m)[c] = readMatrix(r, c);
+// Returns NULL unless r and c are positive, r*c is at most 2^30 and all
+// r*c numbers arrive.
+static void* readMatrix(int r, int c) {
+    if (r <= 0 || c <= 0 || r > (1 << 30) / c) return NULL;
+    int count = r * c;
+    int *m = readInts(&count);
+    if (m && count < r * c) {
+        free(m);
+        return NULL;
+    }
+    return m;
+}
+
 typedef struct {
     int x, y;
 } Point;
 
-int orangesRotting(int grid[][100], int m, int n) {
+int orangesRotting(int m, int n, int grid[][n]) {
     int fresh = 0;
-    Point queue[10000];
+    Point *queue = malloc((m * n > 0 ? m * n : 1) * sizeof(Point));   // each cell enters at most once
     int front = 0, rear = 0;
     for (int i = 0; i < m; i++) {
         for (int j = 0; j < n; j++) {
@@ -18,7 +82,10 @@ int orangesRotting(int grid[][100], int m, int n) {
             }
         }
     }
-    if (fresh == 0) return 0;
+    if (fresh == 0) {
+        free(queue);
+        return 0;
+    }
 
     int dirs[4][2] = {{1,0},{-1,0},{0,1},{0,-1}};
     int minutes = 0;
@@ -38,20 +105,30 @@ int orangesRotting(int grid[][100], int m, int n) {
         }
         minutes++;
     }
+    free(queue);
     return (fresh == 0) ? minutes - 1 : -1;
 }
 
 int main() {
-    int m, n;
+    int m = 0, n = 0;
     printf("Enter rows and cols: ");
-    scanf("%d %d", &m, &n);
-    int grid[100][100];
+    if(!readInt(&m) || !readInt(&n)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Grid:\n");
-    for (int i = 0; i < m; i++)
-        for (int j = 0; j < n; j++)
-            scanf("%d", &grid[i][j]);
+    if(m <= 0 || n <= 0) {
+        printf("Invalid size.\n");
+        return 1;
+    }
+    int (*grid)[n] = readMatrix(m, n);
+    if(!grid) {
+        printf("Not enough input.\n");
+        return 1;
+    }
 
-    int time = orangesRotting(grid, m, n);
+    int time = orangesRotting(m, n, grid);
     printf("Minutes = %d\n", time);
+    free(grid);
     return 0;
 }
@@ -1,7 +1,72 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <limits.h>
 
-int countLessEqual(int matrix[][100], int m, int n, int x) {
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
+// Read an r x c matrix into one heap block. Use it through a pointer to
+// a row so m[i][j] still works: int (*m)[c] = readMatrix(r, c);
+// Returns NULL unless r and c are positive, r*c is at most 2^30 and all
+// r*c numbers arrive.
+static void* readMatrix(int r, int c) {
+    if (r <= 0 || c <= 0 || r > (1 << 30) / c) return NULL;
+    int count = r * c;
+    int *m = readInts(&count);
+    if (m && count < r * c) {
+        free(m);
+        return NULL;
+    }
+    return m;
+}
+
+int countLessEqual(int m, int n, int matrix[][n], int x) {
     int count = 0;
     for (int i = 0; i < m; i++) {
         int lo = 0, hi = n-1;
@@ -17,7 +82,7 @@ int countLessEqual(int matrix[][100], int m, int n, int x) {
     return count;
 }
 
-int findMedian(int matrix[][100], int m, int n) {
+int findMedian(int m, int n, int matrix[][n]) {
     int low = INT_MAX, high = INT_MIN;
     for (int i = 0; i < m; i++) {
         if (matrix[i][0] < low) low = matrix[i][0];
@@ -26,7 +91,7 @@ int findMedian(int matrix[][100], int m, int n) {
     int desired = (m * n + 1) / 2;
     while (low < high) {
         int mid = low + (high - low) / 2;
-        int count = countLessEqual(matrix, m, n, mid);
+        int count = countLessEqual(m, n, matrix, mid);
         if (count < desired)
             low = mid + 1;
         else
@@ -36,16 +101,25 @@ int findMedian(int matrix[][100], int m, int n) {
 }
 
 int main() {
-    int m, n;
+    int m = 0, n = 0;
     printf("Enter rows and cols: ");
-    scanf("%d %d", &m, &n);
-    int mat[100][100];
+    if(!readInt(&m) || !readInt(&n)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Matrix:\n");
-    for (int i = 0; i < m; i++)
-        for (int j = 0; j < n; j++)
-            scanf("%d", &mat[i][j]);
+    if(m <= 0 || n <= 0) {
+        printf("Invalid size.\n");
+        return 1;
+    }
+    int (*mat)[n] = readMatrix(m, n);
+    if(!mat) {
+        printf("Not enough input.\n");
+        return 1;
+    }
 
-    int median = findMedian(mat, m, n);
+    int median = findMedian(m, n, mat);
     printf("Median = %d\n", median);
+    free(mat);
     return 0;
 }
@@ -1,7 +1,72 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdbool.h>
 
-bool searchMatrix(int matrix[][100], int m, int n, int target, int *row, int *col) {
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
+// Read an r x c matrix into one heap block. Use it through a pointer to
+// a row so m[i][j] still works: int (*m)[c] = readMatrix(r, c);
+// Returns NULL unless r and c are positive, r*c is at most 2^30 and all
+// r*c numbers arrive.
+static void* readMatrix(int r, int c) {
+    if (r <= 0 || c <= 0 || r > (1 << 30) / c) return NULL;
+    int count = r * c;
+    int *m = readInts(&count);
+    if (m && count < r * c) {
+        free(m);
+        return NULL;
+    }
+    return m;
+}
+
+bool searchMatrix(int m, int n, int matrix[][n], int target, int *row, int *col) {
     int i = 0, j = n - 1;
     while (i < m && j >= 0) {
         if (matrix[i][j] == target) {
@@ -17,21 +82,34 @@ bool searchMatrix(int matrix[][100], int m, int n, int target, int *row, int *co
 }
 
 int main() {
-    int m, n, target;
+    int m = 0, n = 0, target = 0;
     printf("Enter rows and cols: ");
-    scanf("%d %d", &m, &n);
-    int mat[100][100];
+    if (!readInt(&m) || !readInt(&n)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Matrix:\n");
-    for (int i = 0; i < m; i++)
-        for (int j = 0; j < n; j++)
-            scanf("%d", &mat[i][j]);
+    if (m <= 0 || n <= 0) {
+        printf("Invalid size.\n");
+        return 1;
+    }
+    int (*mat)[n] = readMatrix(m, n);
+    if (!mat) {
+        printf("Not enough input.\n");
+        return 1;
+    }
     printf("Target: ");
-    scanf("%d", &target);
+    if (!readInt(&target)) {
+        printf("Invalid input.\n");
+        free(mat);
+        return 1;
+    }
 
     int row, col;
-    if (searchMatrix(mat, m, n, target, &row, &col))
+    if (searchMatrix(m, n, mat, target, &row, &col))
         printf("Element found at (%d,%d)\n", row, col);
     else
         printf("Element not found\n");
+    free(mat);
     return 0;
 }
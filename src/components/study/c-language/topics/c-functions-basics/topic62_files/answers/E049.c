@@ -1,8 +1,58 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <limits.h>
 
+// Fast input: stdin is pulled in 64 KB blocks and integers are parsed
+// by hand, which is many times faster than one scanf("%d") per element.
+static char inBuf[1 << 16];
+static size_t inLen = 0, inPos = 0;
+
+static int nextChar() {
+    if (inPos == inLen) {
+        inLen = fread(inBuf, 1, sizeof inBuf, stdin);
+        inPos = 0;
+        if (inLen == 0) return EOF;
+    }
+    return (unsigned char)inBuf[inPos++];
+}
+
+// Like scanf("%d", x): returns 1 if an integer was read, 0 otherwise
+static int readInt(int *x) {
+    int c = nextChar();
+    while (c == ' ' || c == '\n' || c == '\t' || c == '\r') c = nextChar();
+    int neg = (c == '-');
+    if (neg || c == '+') c = nextChar();
+    if (c < '0' || c > '9') return 0;
+    unsigned v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (unsigned)(c - '0');
+        c = nextChar();
+    }
+    *x = neg ? (int)(0u - v) : (int)v;
+    return 1;
+}
+
+// Read up to *n integers into a heap array that grows as they arrive;
+// *n becomes the number actually read. The caller frees the array.
+static int* readInts(int *n) {
+    int size = 0, cap = 1024;
+    int *a = malloc(cap * sizeof(int));
+    while (a && size < *n) {
+        if (size == cap) {
+            int *tmp = realloc(a, 2 * (size_t)cap * sizeof(int));
+            if (!tmp) break;
+            a = tmp;
+            cap *= 2;
+        }
+        if (!readInt(&a[size])) break;
+        size++;
+    }
+    *n = size;
+    return a;
+}
+
 int coinChange(int coins[], int m, int amount) {
-    int dp[amount+1];
+    int *dp = malloc((amount + 1) * sizeof(int));
     for (int i = 1; i <= amount; i++) dp[i] = INT_MAX;
     dp[0] = 0;
     for (int i = 1; i <= amount; i++) {
@@ -13,20 +63,41 @@ int coinChange(int coins[], int m, int amount) {
             }
         }
     }
-    return dp[amount] == INT_MAX ? -1 : dp[amount];
+    int result = dp[amount] == INT_MAX ? -1 : dp[amount];
+    free(dp);
+    return result;
 }
 
 int main() {
-    int m, amount;
+    int m = 0, amount = 0;
     printf("Enter number of denominations: ");
-    scanf("%d", &m);
-    int coins[m];
+    if (!readInt(&m)) {
+        printf("Invalid input.\n");
+        return 1;
+    }
     printf("Denominations: ");
-    for (int i = 0; i < m; i++) scanf("%d", &coins[i]);
+    int *coins = readInts(&m);
+    for (int i = 0; i < m; i++) {
+        if (coins[i] <= 0) {
+            printf("Denominations must be positive.\n");
+            free(coins);
+            return 1;
+        }
+    }
     printf("Amount: ");
-    scanf("%d", &amount);
+    if (!readInt(&amount)) {
+        printf("Invalid input.\n");
+        free(coins);
+        return 1;
+    }
+    if (amount < 0 || amount == INT_MAX) {
+        printf("Invalid amount.\n");
+        free(coins);
+        return 1;
+    }
 
     int minCoins = coinChange(coins, m, amount);
     printf("Minimum coins = %d\n", minCoins);
+    free(coins);
     return 0;
 }
@@ -120,7 +120,7 @@ const Topic10 = () => {
             <p className="font-mono text-sm mb-3">create new string from two strings; or append one to another.</p>
             
             <h3 className="text-xl font-medium mb-2 mt-4">Destruction</h3>
-            <p className="font-mono text-sm">free(data).</p>
+            <p className="font-mono text-sm">free(data) — or, for strings created from an arena, rewind/reset the arena to release all of them at once.</p>
           </div>
         </section>
 
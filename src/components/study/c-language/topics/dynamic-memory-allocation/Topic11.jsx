@@ -6,6 +6,7 @@ import EditableCCodeBlock from '../../../../../common/EditableCCodeBlock';
 // Import C code examples as raw strings
 import internalFrag from './topic11_files/internal_fragmentation.c?raw';
 import externalFrag from './topic11_files/external_fragmentation.c?raw';
+import traceRecorder from './topic11_files/trace_recorder.c?raw';
 import preventFrag from './topic11_files/fragmentation_prevention.c?raw';
 
 // Keyframes for reveal animations (inline style)
@@ -174,15 +175,19 @@ const Topic11 = () => {
           </h2>
           <div className="space-y-6">
             <EditableCCodeBlock
-              title="Example 1: Internal fragmentation (alignment overhead)"
+              title="Example 1: Internal fragmentation (size-class slab allocator)"
               initialCode={internalFrag}
             />
             <EditableCCodeBlock
-              title="Example 2: External fragmentation (allocation pattern)"
+              title="Example 2: External fragmentation (trace-replay benchmark across allocators)"
               initialCode={externalFrag}
             />
             <EditableCCodeBlock
-              title="Example 3: Reducing fragmentation (pool allocator)"
+              title="Trace recorder for Example 2 (LD_PRELOAD: record a real program's malloc/free)"
+              initialCode={traceRecorder}
+            />
+            <EditableCCodeBlock
+              title="Example 3: Reducing fragmentation (O(1) free-list pool allocator)"
               initialCode={preventFrag}
             />
           </div>
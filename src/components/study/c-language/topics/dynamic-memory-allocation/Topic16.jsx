@@ -178,7 +178,7 @@ const Topic16 = () => {
               initialCode={pointerTracking}
             />
             <EditableCCodeBlock
-              title="Example 2: Allocation counter"
+              title="Example 2: Low-overhead allocation profiler"
               initialCode={allocationCount}
             />
             <EditableCCodeBlock
@@ -7,6 +7,8 @@ import EditableCCodeBlock from '../../../../../common/EditableCCodeBlock';
 import valgrindLeak from './topic17_files/valgrind_leak.c?raw';
 import valgrindUseAfterFree from './topic17_files/valgrind_use_after_free.c?raw';
 import valgrindInvalidRead from './topic17_files/valgrind_invalid_read.c?raw';
+import guardedHeap from './topic17_files/guarded_heap.c?raw';
+import guardedHeapHeader from './topic17_files/guarded_heap.h.c?raw';
 
 // Keyframes for reveal animations (inline style)
 const keyframesStyle = `
@@ -191,6 +193,14 @@ const Topic17 = () => {
               title="Example 3: Invalid read (buffer overflow)"
               initialCode={valgrindInvalidRead}
             />
+            <EditableCCodeBlock
+              title="Example 4: Guarded heap (red zones, quarantine, double-free check) — no Valgrind needed"
+              initialCode={guardedHeap}
+            />
+            <EditableCCodeBlock
+              title="guarded_heap.h — build Examples 1–3 with -DGUARDED_HEAP to run them on the guarded heap"
+              initialCode={guardedHeapHeader}
+            />
           </div>
         </section>
 
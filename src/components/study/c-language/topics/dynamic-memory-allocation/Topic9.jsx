@@ -6,7 +6,6 @@ import EditableCCodeBlock from '../../../../../common/EditableCCodeBlock';
 // Import C code examples as raw strings
 import simpleDynamicArray from './topic9_files/simple_dynamic_array.c?raw';
 import dynamicArrayWithGrowth from './topic9_files/dynamic_array_growth.c?raw';
-import dynamicArrayWithShrink from './topic9_files/dynamic_array_shrink.c?raw';
 
 // Keyframes for reveal animations (inline style)
 const keyframesStyle = `
@@ -184,13 +183,9 @@ const Topic9 = () => {
               initialCode={simpleDynamicArray}
             />
             <EditableCCodeBlock
-              title="Example 2: Growth strategy (doubling)"
+              title="Example 2: Growth policy (1.5x / 2x, shrink hysteresis, reserve, mmap + mremap for huge arrays)"
               initialCode={dynamicArrayWithGrowth}
             />
-            <EditableCCodeBlock
-              title="Example 3: Shrinking strategy"
-              initialCode={dynamicArrayWithShrink}
-            />
           </div>
         </section>
 
@@ -2,29 +2,133 @@
 #include <stdlib.h>
 #include <string.h>
 
+// ---------------- Arena (bump) allocator ----------------
+// Strings created from an arena take their header and buffer from large
+// blocks by bumping a pointer. Nothing is freed one by one: rewinding to a
+// mark or resetting the arena releases every string created after it at once.
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *prev;    // older block
+    size_t capacity;
+    size_t used;
+    char data[];
+} ArenaBlock;
+
+typedef struct {
+    ArenaBlock *head;           // newest block, the one we bump from
+} Arena;
+
+typedef struct {
+    ArenaBlock *block;
+    size_t used;
+} ArenaMark;
+
+#define ARENA_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+void* arena_alloc(Arena *a, size_t size) {
+    size = ARENA_ALIGN(size);
+    ArenaBlock *b = a->head;
+    if (!b || b->used + size > b->capacity) {
+        size_t cap = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+        b = malloc(sizeof(ArenaBlock) + cap);
+        if (!b) return NULL;
+        b->prev = a->head;
+        b->capacity = cap;
+        b->used = 0;
+        a->head = b;
+    }
+    void *p = b->data + b->used;
+    b->used += size;
+    return p;
+}
+
+// Grow an arena allocation. If it is the most recent one and the block has
+// room, it is extended in place; otherwise the bytes are copied to a new spot.
+void* arena_realloc(Arena *a, void *old, size_t old_size, size_t new_size) {
+    ArenaBlock *b = a->head;
+    old_size = ARENA_ALIGN(old_size);
+    if (b && (char*)old + old_size == b->data + b->used &&
+        (size_t)((char*)old - b->data) + new_size <= b->capacity) {
+        b->used = (size_t)((char*)old - b->data) + ARENA_ALIGN(new_size);
+        return old;
+    }
+    void *p = arena_alloc(a, new_size);
+    if (p && old) memcpy(p, old, old_size < new_size ? old_size : new_size);
+    return p;
+}
+
+ArenaMark arena_mark(const Arena *a) {
+    ArenaMark m = { a->head, a->head ? a->head->used : 0 };
+    return m;
+}
+
+// Release everything allocated after the mark
+void arena_rewind(Arena *a, ArenaMark m) {
+    while (a->head != m.block) {
+        ArenaBlock *prev = a->head->prev;
+        free(a->head);
+        a->head = prev;
+    }
+    if (a->head) a->head->used = m.used;
+}
+
+// Release everything but keep one block around for the next request
+void arena_reset(Arena *a) {
+    while (a->head && a->head->prev) {
+        ArenaBlock *prev = a->head->prev;
+        free(a->head);
+        a->head = prev;
+    }
+    if (a->head) a->head->used = 0;
+}
+
+void arena_destroy(Arena *a) {
+    ArenaMark empty = { NULL, 0 };
+    arena_rewind(a, empty);
+}
+
+// ---------------- Dynamic string ----------------
+
 typedef struct {
     char *data;
     int length;
     int capacity;
+    Arena *arena;               // NULL: heap mode, otherwise arena mode
 } DynamicString;
 
-DynamicString* str_create() {
-    DynamicString *s = malloc(sizeof(DynamicString));
+// Create a string whose memory comes from the arena (or the heap if NULL)
+DynamicString* str_create_in(Arena *arena) {
+    DynamicString *s = arena ? arena_alloc(arena, sizeof(DynamicString))
+                             : malloc(sizeof(DynamicString));
     if (!s) return NULL;
+    s->arena = arena;
     s->capacity = 8;
-    s->data = malloc(s->capacity);
-    if (!s->data) { free(s); return NULL; }
+    s->data = arena ? arena_alloc(arena, s->capacity) : malloc(s->capacity);
+    if (!s->data) { if (!arena) free(s); return NULL; }
     s->data[0] = '\0';
     s->length = 0;
     return s;
 }
 
+DynamicString* str_create() {
+    return str_create_in(NULL);
+}
+
+static int str_grow(DynamicString *s, int new_capacity) {
+    char *new_data = s->arena
+        ? arena_realloc(s->arena, s->data, s->capacity, new_capacity)
+        : realloc(s->data, new_capacity);
+    if (!new_data) return 0;
+    s->data = new_data;
+    s->capacity = new_capacity;
+    return 1;
+}
+
 void str_append_char(DynamicString *s, char ch) {
     if (s->length + 2 > s->capacity) {
-        s->capacity *= 2;
-        char *new_data = realloc(s->data, s->capacity);
-        if (!new_data) return;
-        s->data = new_data;
+        if (!str_grow(s, s->capacity * 2)) return;
     }
     s->data[s->length] = ch;
     s->length++;
@@ -34,18 +138,18 @@ void str_append_char(DynamicString *s, char ch) {
 void str_append_cstr(DynamicString *s, const char *cstr) {
     int len = strlen(cstr);
     if (s->length + len + 1 > s->capacity) {
-        while (s->length + len + 1 > s->capacity)
-            s->capacity *= 2;
-        char *new_data = realloc(s->data, s->capacity);
-        if (!new_data) return;
-        s->data = new_data;
+        int new_capacity = s->capacity;
+        while (s->length + len + 1 > new_capacity)
+            new_capacity *= 2;
+        if (!str_grow(s, new_capacity)) return;
     }
     strcpy(s->data + s->length, cstr);
     s->length += len;
 }
 
+// Arena strings are released together by arena_rewind/arena_reset
 void str_free(DynamicString *s) {
-    if (s) {
+    if (s && !s->arena) {
         free(s->data);
         free(s);
     }
@@ -61,5 +165,23 @@ int main() {
     str_append_cstr(s, " world!");
     printf("%s\n", s->data);
     str_free(s);
+
+    // Arena mode: build many short-lived strings per "request",
+    // then drop them all in O(1) without a single str_free
+    Arena arena = { NULL };
+    for (int request = 1; request <= 3; request++) {
+        ArenaMark start = arena_mark(&arena);
+        DynamicString *last = NULL;
+        for (int i = 0; i < 1000; i++) {
+            DynamicString *t = str_create_in(&arena);
+            str_append_cstr(t, "request-");
+            str_append_char(t, (char)('0' + request));
+            str_append_cstr(t, "-item");
+            last = t;
+        }
+        printf("Request %d: built 1000 strings, last = %s\n", request, last->data);
+        arena_rewind(&arena, start);
+    }
+    arena_destroy(&arena);
     return 0;
-}
\ No newline at end of file
+}
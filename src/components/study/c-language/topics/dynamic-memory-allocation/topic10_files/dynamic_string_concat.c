@@ -1,47 +1,224 @@
+#define _DEFAULT_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdarg.h>
+
+// ---------------- Arena (bump) allocator ----------------
+// Strings created from an arena take their header and buffer from large
+// blocks by bumping a pointer. Nothing is freed one by one: rewinding to a
+// mark or resetting the arena releases every string created after it at once.
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *prev;    // older block
+    size_t capacity;
+    size_t used;
+    char data[];
+} ArenaBlock;
+
+typedef struct {
+    ArenaBlock *head;           // newest block, the one we bump from
+} Arena;
+
+typedef struct {
+    ArenaBlock *block;
+    size_t used;
+} ArenaMark;
+
+#define ARENA_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+void* arena_alloc(Arena *a, size_t size) {
+    size = ARENA_ALIGN(size);
+    ArenaBlock *b = a->head;
+    if (!b || b->used + size > b->capacity) {
+        size_t cap = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+        b = malloc(sizeof(ArenaBlock) + cap);
+        if (!b) return NULL;
+        b->prev = a->head;
+        b->capacity = cap;
+        b->used = 0;
+        a->head = b;
+    }
+    void *p = b->data + b->used;
+    b->used += size;
+    return p;
+}
+
+// Grow an arena allocation. If it is the most recent one and the block has
+// room, it is extended in place; otherwise the bytes are copied to a new spot.
+void* arena_realloc(Arena *a, void *old, size_t old_size, size_t new_size) {
+    ArenaBlock *b = a->head;
+    old_size = ARENA_ALIGN(old_size);
+    if (b && (char*)old + old_size == b->data + b->used &&
+        (size_t)((char*)old - b->data) + new_size <= b->capacity) {
+        b->used = (size_t)((char*)old - b->data) + ARENA_ALIGN(new_size);
+        return old;
+    }
+    void *p = arena_alloc(a, new_size);
+    if (p && old) memcpy(p, old, old_size < new_size ? old_size : new_size);
+    return p;
+}
+
+ArenaMark arena_mark(const Arena *a) {
+    ArenaMark m = { a->head, a->head ? a->head->used : 0 };
+    return m;
+}
+
+// Release everything allocated after the mark
+void arena_rewind(Arena *a, ArenaMark m) {
+    while (a->head != m.block) {
+        ArenaBlock *prev = a->head->prev;
+        free(a->head);
+        a->head = prev;
+    }
+    if (a->head) a->head->used = m.used;
+}
+
+// Release everything but keep one block around for the next request
+void arena_reset(Arena *a) {
+    while (a->head && a->head->prev) {
+        ArenaBlock *prev = a->head->prev;
+        free(a->head);
+        a->head = prev;
+    }
+    if (a->head) a->head->used = 0;
+}
+
+void arena_destroy(Arena *a) {
+    ArenaMark empty = { NULL, 0 };
+    arena_rewind(a, empty);
+}
+
+// ---------------- String ----------------
+// Small-string optimization: strings of up to SSO_CAPACITY characters are
+// stored in the struct itself, so str_new() makes a single allocation.
+// 'data' always points at the characters (inline or heap), so callers
+// never need to know which representation is in use.
+
+#define SSO_CAPACITY 23
 
 typedef struct {
     char *data;
     int length;
-    int capacity;
+    int capacity;               // bytes available at data, including '\0'
+    Arena *arena;               // NULL: heap mode, otherwise arena mode
+    char small[SSO_CAPACITY + 1];
 } String;
 
-String* str_new() {
-    String *s = malloc(sizeof(String));
+void str_free(String *s);
+
+static int str_is_inline(const String *s) {
+    return s->data == s->small;
+}
+
+String* str_new_in(Arena *arena) {
+    String *s = arena ? arena_alloc(arena, sizeof(String)) : malloc(sizeof(String));
     if (!s) return NULL;
-    s->capacity = 16;
-    s->data = malloc(s->capacity);
-    if (!s->data) { free(s); return NULL; }
+    s->arena = arena;
+    s->data = s->small;
+    s->capacity = sizeof(s->small);
     s->data[0] = '\0';
     s->length = 0;
     return s;
 }
 
+String* str_new() {
+    return str_new_in(NULL);
+}
+
+// Grow to hold at least 'needed' bytes; moves inline strings to the heap/arena
+static int str_reserve(String *s, int needed) {
+    if (needed <= s->capacity) return 1;
+    int new_capacity = s->capacity;
+    while (needed > new_capacity)
+        new_capacity *= 2;
+    char *tmp;
+    if (str_is_inline(s)) {
+        tmp = s->arena ? arena_alloc(s->arena, new_capacity) : malloc(new_capacity);
+        if (tmp) memcpy(tmp, s->small, s->length + 1);
+    } else {
+        tmp = s->arena
+            ? arena_realloc(s->arena, s->data, s->capacity, new_capacity)
+            : realloc(s->data, new_capacity);
+    }
+    if (!tmp) return 0;
+    s->data = tmp;
+    s->capacity = new_capacity;
+    return 1;
+}
+
+// Append 'len' bytes whose length the caller already knows: no strlen
+void str_append_n(String *s, const char *text, int len) {
+    if (!str_reserve(s, s->length + len + 1)) return;
+    memcpy(s->data + s->length, text, len);
+    s->length += len;
+    s->data[s->length] = '\0';
+}
+
 void str_append(String *s, const char *text) {
-    int add_len = strlen(text);
-    if (s->length + add_len + 1 > s->capacity) {
-        while (s->length + add_len + 1 > s->capacity)
-            s->capacity *= 2;
-        char *tmp = realloc(s->data, s->capacity);
-        if (!tmp) return;
-        s->data = tmp;
+    str_append_n(s, text, strlen(text));
+}
+
+// printf-style append that formats straight into the spare capacity.
+// If the output doesn't fit, grow once to the exact size and format again.
+void str_appendf(String *s, const char *fmt, ...) {
+    va_list args, retry;
+    va_start(args, fmt);
+    va_copy(retry, args);
+    int spare = s->capacity - s->length;
+    int n = vsnprintf(s->data + s->length, spare, fmt, args);
+    if (n >= spare && str_reserve(s, s->length + n + 1))
+        vsnprintf(s->data + s->length, n + 1, fmt, retry);
+    else if (n >= spare)
+        n = -1;                             // out of memory: leave s unchanged
+    if (n >= 0) s->length += n;
+    s->data[s->length] = '\0';
+    va_end(retry);
+    va_end(args);
+}
+
+// Join n strings with 'sep': measure everything first, allocate once, copy once
+String* str_join_in(Arena *arena, const char *parts[], int n, const char *sep) {
+    String *res = str_new_in(arena);
+    if (!res || n == 0) return res;
+    int sep_len = strlen(sep);
+    int total = sep_len * (n - 1);
+    for (int i = 0; i < n; i++)
+        total += strlen(parts[i]);
+    if (!str_reserve(res, total + 1)) { str_free(res); return NULL; }
+
+    char *p = res->data;
+    for (int i = 0; i < n; i++) {
+        if (i > 0) { memcpy(p, sep, sep_len); p += sep_len; }
+        p = stpcpy(p, parts[i]);            // copies and returns the new end
     }
-    strcpy(s->data + s->length, text);
-    s->length += add_len;
+    res->length = total;
+    return res;
+}
+
+String* str_join(const char *parts[], int n, const char *sep) {
+    return str_join_in(NULL, parts, n, sep);
 }
 
+// The result lives in the same arena as 'a' (or on the heap).
+// Both lengths are already known, so this is one reserve and two memcpys.
 String* str_concat(const String *a, const String *b) {
-    String *res = str_new();
+    String *res = str_new_in(a->arena);
     if (!res) return NULL;
-    str_append(res, a->data);
-    str_append(res, b->data);
+    if (!str_reserve(res, a->length + b->length + 1)) { str_free(res); return NULL; }
+    str_append_n(res, a->data, a->length);
+    str_append_n(res, b->data, b->length);
     return res;
 }
 
+// Arena strings are released together by arena_rewind/arena_reset
 void str_free(String *s) {
-    if (s) { free(s->data); free(s); }
+    if (s && !s->arena) {
+        if (!str_is_inline(s)) free(s->data);
+        free(s);
+    }
 }
 
 int main() {
@@ -51,8 +228,37 @@ int main() {
     str_append(s2, "world!");
     String *s3 = str_concat(s1, s2);
     printf("%s\n", s3->data);
+    printf("\"%s\" is %s\n", s3->data, str_is_inline(s3) ? "inline (SSO)" : "on the heap");
+    str_append(s3, " This sentence no longer fits inline.");
+    printf("\"%s\" is %s\n", s3->data, str_is_inline(s3) ? "inline (SSO)" : "on the heap");
     str_free(s1);
     str_free(s2);
     str_free(s3);
+
+    // Assembling output from many fragments
+    const char *parts[] = {"alpha", "beta", "gamma", "delta", "epsilon"};
+    String *csv = str_join(parts, 5, ", ");
+    printf("Joined: %s (length %d)\n", csv->data, csv->length);
+    str_free(csv);
+
+    String *report = str_new();
+    for (int i = 1; i <= 3; i++)
+        str_appendf(report, "[item %d: %.2f] ", i, i * 1.5);
+    str_append_n(report, "done", 4);
+    printf("Formatted: %s\n", report->data);
+    str_free(report);
+
+    // Arena mode: one arena per request, reset in O(1) when the request ends
+    Arena arena = { NULL };
+    for (int request = 1; request <= 3; request++) {
+        String *greeting = str_new_in(&arena);
+        String *name = str_new_in(&arena);
+        str_append(greeting, "Hello, ");
+        str_append(name, request == 1 ? "Alice" : request == 2 ? "Bob" : "Carol");
+        String *msg = str_concat(greeting, name);
+        printf("Request %d: %s\n", request, msg->data);
+        arena_reset(&arena);        // no str_free needed
+    }
+    arena_destroy(&arena);
     return 0;
-}
\ No newline at end of file
+}
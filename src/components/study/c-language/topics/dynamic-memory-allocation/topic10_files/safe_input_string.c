@@ -1,57 +1,321 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+
+// ---------------- Arena (bump) allocator ----------------
+// Strings created from an arena take their header and buffer from large
+// blocks by bumping a pointer. Nothing is freed one by one: rewinding to a
+// mark or resetting the arena releases every string created after it at once.
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *prev;    // older block
+    size_t capacity;
+    size_t used;
+    char data[];
+} ArenaBlock;
+
+typedef struct {
+    ArenaBlock *head;           // newest block, the one we bump from
+} Arena;
+
+typedef struct {
+    ArenaBlock *block;
+    size_t used;
+} ArenaMark;
+
+#define ARENA_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+void* arena_alloc(Arena *a, size_t size) {
+    size = ARENA_ALIGN(size);
+    ArenaBlock *b = a->head;
+    if (!b || b->used + size > b->capacity) {
+        size_t cap = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+        b = malloc(sizeof(ArenaBlock) + cap);
+        if (!b) return NULL;
+        b->prev = a->head;
+        b->capacity = cap;
+        b->used = 0;
+        a->head = b;
+    }
+    void *p = b->data + b->used;
+    b->used += size;
+    return p;
+}
+
+// Grow an arena allocation. If it is the most recent one and the block has
+// room, it is extended in place; otherwise the bytes are copied to a new spot.
+void* arena_realloc(Arena *a, void *old, size_t old_size, size_t new_size) {
+    ArenaBlock *b = a->head;
+    old_size = ARENA_ALIGN(old_size);
+    if (b && (char*)old + old_size == b->data + b->used &&
+        (size_t)((char*)old - b->data) + new_size <= b->capacity) {
+        b->used = (size_t)((char*)old - b->data) + ARENA_ALIGN(new_size);
+        return old;
+    }
+    void *p = arena_alloc(a, new_size);
+    if (p && old) memcpy(p, old, old_size < new_size ? old_size : new_size);
+    return p;
+}
+
+ArenaMark arena_mark(const Arena *a) {
+    ArenaMark m = { a->head, a->head ? a->head->used : 0 };
+    return m;
+}
+
+// Release everything allocated after the mark
+void arena_rewind(Arena *a, ArenaMark m) {
+    while (a->head != m.block) {
+        ArenaBlock *prev = a->head->prev;
+        free(a->head);
+        a->head = prev;
+    }
+    if (a->head) a->head->used = m.used;
+}
+
+// Release everything but keep one block around for the next request
+void arena_reset(Arena *a) {
+    while (a->head && a->head->prev) {
+        ArenaBlock *prev = a->head->prev;
+        free(a->head);
+        a->head = prev;
+    }
+    if (a->head) a->head->used = 0;
+}
+
+void arena_destroy(Arena *a) {
+    ArenaMark empty = { NULL, 0 };
+    arena_rewind(a, empty);
+}
+
+// ---------------- DynStr ----------------
+// Small-string optimization: up to SSO_CAPACITY characters live inside the
+// struct, so ds_create() makes one allocation instead of two. 'data' always
+// points at the characters, inline or not.
+
+#define SSO_CAPACITY 23
 
 typedef struct {
     char *data;
     int length;
-    int capacity;
+    int capacity;               // bytes available at data, including '\0'
+    Arena *arena;               // NULL: heap mode, otherwise arena mode
+    char small[SSO_CAPACITY + 1];
 } DynStr;
 
-DynStr* ds_create() {
-    DynStr *ds = malloc(sizeof(DynStr));
+static int ds_is_inline(const DynStr *ds) {
+    return ds->data == ds->small;
+}
+
+DynStr* ds_create_in(Arena *arena) {
+    DynStr *ds = arena ? arena_alloc(arena, sizeof(DynStr)) : malloc(sizeof(DynStr));
     if (!ds) return NULL;
-    ds->capacity = 16;
-    ds->data = malloc(ds->capacity);
-    if (!ds->data) { free(ds); return NULL; }
+    ds->arena = arena;
+    ds->data = ds->small;
+    ds->capacity = sizeof(ds->small);
     ds->data[0] = '\0';
     ds->length = 0;
     return ds;
 }
 
-void ds_append_char(DynStr *ds, char ch) {
-    if (ds->length + 2 > ds->capacity) {
-        ds->capacity *= 2;
-        char *tmp = realloc(ds->data, ds->capacity);
-        if (!tmp) return;
-        ds->data = tmp;
+DynStr* ds_create() {
+    return ds_create_in(NULL);
+}
+
+// Grow to hold at least 'needed' bytes; the first growth moves an inline
+// string out to the heap (or the arena)
+static int ds_reserve(DynStr *ds, int needed) {
+    if (needed <= ds->capacity) return 1;
+    int new_capacity = ds->capacity;
+    while (needed > new_capacity)
+        new_capacity *= 2;
+    char *tmp;
+    if (ds_is_inline(ds)) {
+        tmp = ds->arena ? arena_alloc(ds->arena, new_capacity) : malloc(new_capacity);
+        if (tmp) memcpy(tmp, ds->small, ds->length + 1);
+    } else {
+        tmp = ds->arena
+            ? arena_realloc(ds->arena, ds->data, ds->capacity, new_capacity)
+            : realloc(ds->data, new_capacity);
     }
+    if (!tmp) return 0;
+    ds->data = tmp;
+    ds->capacity = new_capacity;
+    return 1;
+}
+
+void ds_append_char(DynStr *ds, char ch) {
+    if (!ds_reserve(ds, ds->length + 2)) return;
     ds->data[ds->length] = ch;
     ds->length++;
     ds->data[ds->length] = '\0';
 }
 
+// Append n bytes at once: one capacity check, one memcpy.
+// Returns 0 (string unchanged) if it could not grow.
+int ds_append_n(DynStr *ds, const char *src, int n) {
+    if (!ds_reserve(ds, ds->length + n + 1)) return 0;
+    memcpy(ds->data + ds->length, src, n);
+    ds->length += n;
+    ds->data[ds->length] = '\0';
+    return 1;
+}
+
+// Arena strings are released together by arena_rewind/arena_reset
 void ds_free(DynStr *ds) {
-    if (ds) { free(ds->data); free(ds); }
+    if (ds && !ds->arena) {
+        if (!ds_is_inline(ds)) free(ds->data);
+        free(ds);
+    }
+}
+
+// ---------------- Buffered line reader ----------------
+// Reads input in 64 KB blocks with read() and finds newlines with memchr
+// (which libc implements with SIMD), instead of one getchar() per byte.
+// Lines longer than the buffer make it grow, so every line is contiguous.
+
+#define READER_BLOCK (64 * 1024)
+
+typedef struct {
+    int fd;
+    char *buf;
+    size_t cap;
+    size_t start;               // first byte of the next line
+    size_t scanned;             // bytes after start already known to have no '\n'
+    size_t end;                 // end of valid data
+    int eof;
+    int error;                  // 0, or the errno that cut the input short (e.g. ENOMEM)
+} LineReader;
+
+int lr_init(LineReader *lr, int fd) {
+    lr->fd = fd;
+    lr->cap = READER_BLOCK;
+    lr->buf = malloc(lr->cap);
+    lr->start = lr->scanned = lr->end = 0;
+    lr->eof = 0;
+    lr->error = 0;
+    return lr->buf != NULL;
+}
+
+void lr_free(LineReader *lr) {
+    free(lr->buf);
+    lr->buf = NULL;
 }
 
-// Read a line from stdin (including spaces) until newline
-DynStr* read_line() {
-    DynStr *line = ds_create();
-    if (!line) return NULL;
-    int ch;
-    while ((ch = getchar()) != EOF && ch != '\n') {
-        ds_append_char(line, (char)ch);
+// Refill: slide the unread tail to the front, grow if it already fills the
+// buffer, then read one more block. Returns 0 at end of input, or on
+// failure with lr->error set.
+static int lr_fill(LineReader *lr) {
+    if (lr->start > 0) {
+        memmove(lr->buf, lr->buf + lr->start, lr->end - lr->start);
+        lr->end -= lr->start;
+        lr->start = 0;
+    }
+    if (lr->end == lr->cap) {
+        char *tmp = realloc(lr->buf, lr->cap * 2);
+        if (!tmp) {
+            lr->error = ENOMEM;
+            return 0;
+        }
+        lr->buf = tmp;
+        lr->cap *= 2;
+    }
+    for (;;) {
+        ssize_t n = read(lr->fd, lr->buf + lr->end, lr->cap - lr->end);
+        if (n > 0) { lr->end += (size_t)n; return 1; }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) lr->error = errno;
+        lr->eof = 1;
+        return 0;
+    }
+}
+
+// Zero-copy mode: *line points into the reader's buffer (not '\0'-terminated,
+// newline excluded) and stays valid only until the next call.
+// Returns 1 if a line was produced, 0 at end of input or on error; check
+// lr->error to tell them apart. A line cut short by an error is not returned.
+int lr_next_view(LineReader *lr, const char **line, size_t *len) {
+    if (lr->error) return 0;
+    for (;;) {
+        char *from = lr->buf + lr->start + lr->scanned;
+        char *nl = memchr(from, '\n', lr->end - lr->start - lr->scanned);
+        if (nl) {
+            *line = lr->buf + lr->start;
+            *len = (size_t)(nl - *line);
+            lr->start = (size_t)(nl - lr->buf) + 1;
+            lr->scanned = 0;
+            return 1;
+        }
+        lr->scanned = lr->end - lr->start;
+        if (lr->eof || !lr_fill(lr)) {
+            if (lr->error || lr->start == lr->end) return 0;
+            *line = lr->buf + lr->start;        // last line without '\n'
+            *len = lr->end - lr->start;
+            lr->start = lr->end;
+            lr->scanned = 0;
+            return 1;
+        }
+    }
+}
+
+// Owning mode: copy the line into a new DynStr in one append.
+// Pass an arena to keep the line in it, or NULL for a heap string.
+// Returns NULL at end of input or on error (then lr->error is set).
+DynStr* read_line_in(LineReader *lr, Arena *arena) {
+    const char *text;
+    size_t len;
+    if (!lr_next_view(lr, &text, &len)) return NULL;
+    if (len >= INT_MAX) {           // DynStr lengths are ints
+        lr->error = EOVERFLOW;
+        return NULL;
+    }
+    DynStr *line = ds_create_in(arena);
+    if (!line || !ds_append_n(line, text, (int)len)) {
+        ds_free(line);
+        lr->error = ENOMEM;
+        return NULL;
     }
     return line;
 }
 
+DynStr* read_line(LineReader *lr) {
+    return read_line_in(lr, NULL);
+}
+
 int main() {
+    LineReader in;
+    if (!lr_init(&in, STDIN_FILENO)) return 1;
+
     printf("Enter a line: ");
-    DynStr *input = read_line();
+    fflush(stdout);             // we bypass stdio for input, so flush the prompt
+    DynStr *input = read_line(&in);
     if (input) {
         printf("You entered: %s\n", input->data);
         ds_free(input);
     }
+
+    // Arena mode: read the remaining lines into one arena,
+    // then release them all at once
+    Arena arena = { NULL };
+    int count = 0;
+    while (read_line_in(&in, &arena))
+        count++;
+    printf("Read %d more line(s) into the arena\n", count);
+    arena_destroy(&arena);
+    if (in.error) {
+        fprintf(stderr, "Input stopped early: %s\n", strerror(in.error));
+        lr_free(&in);
+        return 1;
+    }
+
+    // Zero-copy mode is the fastest way to scan bulk input, e.g.:
+    //   const char *line; size_t len;
+    //   while (lr_next_view(&in, &line, &len)) total += len;
+    lr_free(&in);
     return 0;
-}
\ No newline at end of file
+}
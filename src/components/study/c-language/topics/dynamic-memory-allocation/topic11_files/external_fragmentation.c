@@ -1,35 +1,492 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <malloc.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 
-#define NUM 100
-
-int main() {
-    void *ptrs[NUM];
-    // Allocate many small blocks of different sizes
-    for (int i = 0; i < NUM; i++) {
-        size_t size = (i % 5 + 1) * 10; // sizes: 10,20,30,40,50
-        ptrs[i] = malloc(size);
-        if (!ptrs[i]) {
-            printf("Allocation failed at %d\n", i);
-            break;
+// Allocation-trace benchmark for fragmentation.
+// A trace is a list of operations: "a <id> <size>" allocates, "f <id>" frees.
+// The same trace is replayed against several allocators, each in its own
+// forked process so that peak RSS numbers don't leak into each other.
+// For every allocator we report:
+//   - throughput (operations per second)
+//   - peak RSS growth while replaying
+//   - total free bytes vs the largest contiguous free block at the end of
+//     the trace; a low ratio means the free memory is fragmented
+//
+// Compile with: gcc -O2 -o frag external_fragmentation.c -lm
+// Usage:
+//   ./frag                       built-in traces (classic + synthetic)
+//   ./frag generate out.trace N  write a synthetic trace of N allocations
+//   ./frag replay in.trace       replay a trace file (validated while loading)
+// To record a trace from a real program, preload trace_recorder.c:
+//   TRACE_OUT=app.trace LD_PRELOAD=./libtrace.so ./app && ./frag replay app.trace
+
+// ---------------- Traces ----------------
+
+typedef struct {
+    char op;                    // 'a' or 'f'
+    unsigned id;
+    size_t size;
+} TraceOp;
+
+typedef struct {
+    const char *name;
+    TraceOp *ops;
+    size_t n, cap;
+    unsigned num_ids;
+    size_t max_size;
+} Trace;
+
+static void trace_push(Trace *t, char op, unsigned id, size_t size) {
+    if (t->n == t->cap) {
+        t->cap = t->cap ? t->cap * 2 : 1024;
+        t->ops = realloc(t->ops, t->cap * sizeof(TraceOp));
+        if (!t->ops) { perror("realloc"); exit(1); }
+    }
+    t->ops[t->n++] = (TraceOp){ op, id, size };
+    if (op == 'a') {
+        if (id >= t->num_ids) t->num_ids = id + 1;
+        if (size > t->max_size) t->max_size = size;
+    }
+}
+
+// The original example: 100 blocks of 10..50 bytes, free every other one,
+// then ask for 500 bytes
+static Trace classic_trace(void) {
+    Trace t = { .name = "classic (100 blocks, free every other, then 500 B)" };
+    for (unsigned i = 0; i < 100; i++)
+        trace_push(&t, 'a', i, (i % 5 + 1) * 10);
+    for (unsigned i = 0; i < 100; i += 2)
+        trace_push(&t, 'f', i, 0);
+    trace_push(&t, 'a', 100, 500);
+    return t;
+}
+
+// Synthetic traces: sizes from a distribution, lifetimes exponential
+typedef enum { SIZES_SMALL, SIZES_LOGNORMAL, SIZES_BIMODAL } SizeDist;
+
+static double uniform01(void) {
+    return (rand() + 1.0) / (RAND_MAX + 2.0);
+}
+
+static size_t draw_size(SizeDist d) {
+    switch (d) {
+    case SIZES_SMALL:     return 8 + rand() % 57;                    // 8..64
+    case SIZES_LOGNORMAL: {
+        double z = sqrt(-2 * log(uniform01())) * cos(2 * M_PI * uniform01());
+        double s = exp(4.0 + 1.0 * z);                               // median ~55 B
+        return s < 1 ? 1 : s > 4096 ? 4096 : (size_t)s;
+    }
+    case SIZES_BIMODAL:   return rand() % 10 ? 16 + rand() % 16 : 1024 + rand() % 1024;
+    }
+    return 16;
+}
+
+typedef struct { size_t death; unsigned id; } Pending;
+
+// Min-heap of pending frees keyed by time of death
+static void heap_push(Pending *h, size_t *n, Pending v) {
+    size_t i = (*n)++;
+    while (i && h[(i - 1) / 2].death > v.death) { h[i] = h[(i - 1) / 2]; i = (i - 1) / 2; }
+    h[i] = v;
+}
+
+static Pending heap_pop(Pending *h, size_t *n) {
+    Pending top = h[0], last = h[--*n];
+    size_t i = 0;
+    for (;;) {
+        size_t c = 2 * i + 1;
+        if (c >= *n) break;
+        if (c + 1 < *n && h[c + 1].death < h[c].death) c++;
+        if (h[c].death >= last.death) break;
+        h[i] = h[c];
+        i = c;
+    }
+    h[i] = last;
+    return top;
+}
+
+static Trace synthetic_trace(const char *name, SizeDist dist, double mean_lifetime,
+                             unsigned allocs, unsigned seed) {
+    Trace t = { .name = name };
+    Pending *pending = malloc(allocs * sizeof(Pending));
+    if (!pending) { perror("malloc"); exit(1); }
+    size_t np = 0;
+    srand(seed);
+    for (unsigned now = 0; now < allocs; now++) {
+        while (np && pending[0].death <= now)
+            trace_push(&t, 'f', heap_pop(pending, &np).id, 0);
+        trace_push(&t, 'a', now, draw_size(dist));
+        size_t life = (size_t)(-mean_lifetime * log(uniform01())) + 1;
+        heap_push(pending, &np, (Pending){ now + life, now });
+    }
+    free(pending);                   // still-pending blocks stay live at the end
+    return t;
+}
+
+static int trace_save(const Trace *t, const char *path) {
+    FILE *fp = fopen(path, "w");
+    if (!fp) { perror(path); return -1; }
+    for (size_t i = 0; i < t->n; i++) {
+        if (t->ops[i].op == 'a') fprintf(fp, "a %u %zu\n", t->ops[i].id, t->ops[i].size);
+        else                     fprintf(fp, "f %u\n", t->ops[i].id);
+    }
+    fclose(fp);
+    return 0;
+}
+
+// Ids index the replay's slot table, so they are capped (16M ids = 256 MB
+// of bookkeeping) and every operation must make sense for the id's state:
+// no allocating an id that is still live, no freeing one that isn't.
+#define TRACE_MAX_IDS (1u << 24)
+
+static int trace_error(FILE *fp, const char *path, size_t line, const char *msg) {
+    fprintf(stderr, "%s:%zu: %s\n", path, line, msg);
+    fclose(fp);
+    return -1;
+}
+
+static int trace_load(Trace *t, const char *path) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) { perror(path); return -1; }
+    unsigned char *live = calloc(TRACE_MAX_IDS, 1);
+    if (!live) { fclose(fp); perror("calloc"); return -1; }
+    char buf[256];
+    size_t line = 0;
+    int rc = 0;
+    while (rc == 0 && fgets(buf, sizeof buf, fp)) {
+        line++;
+        char op, extra;
+        unsigned long id;
+        size_t size = 0;
+        int fields = sscanf(buf, " %c %lu %zu %c", &op, &id, &size, &extra);
+        if (fields <= 0) continue;                  // blank line
+        if (op == 'a') {
+            if (fields != 3) rc = trace_error(fp, path, line, "expected \"a <id> <size>\"");
+            else if (id >= TRACE_MAX_IDS) rc = trace_error(fp, path, line, "id out of range");
+            else if (live[id]) rc = trace_error(fp, path, line, "allocating an id that is still live");
+            else { live[id] = 1; trace_push(t, 'a', (unsigned)id, size); }
+        } else if (op == 'f') {
+            if (fields != 2) rc = trace_error(fp, path, line, "expected \"f <id>\"");
+            else if (id >= TRACE_MAX_IDS || !live[id])
+                rc = trace_error(fp, path, line, "freeing an id that was never allocated or is already freed");
+            else { live[id] = 0; trace_push(t, 'f', (unsigned)id, 0); }
+        } else {
+            rc = trace_error(fp, path, line, "unknown operation (expected 'a' or 'f')");
         }
     }
-    // Free every other block to create holes
-    for (int i = 0; i < NUM; i += 2) {
-        free(ptrs[i]);
-        ptrs[i] = NULL;
+    free(live);
+    if (rc == 0) fclose(fp);
+    return rc;
+}
+
+// ---------------- Allocators under test ----------------
+
+typedef struct {
+    const char *name;
+    void  (*init)(size_t max_size);
+    void* (*alloc)(size_t size);
+    void  (*release)(void *p, size_t size);
+    // total and largest contiguous free bytes right now
+    void  (*free_stats)(size_t *total, size_t *largest);
+} Allocator;
+
+static int cmp_ptr(const void *a, const void *b) {
+    char *x = *(char* const*)a, *y = *(char* const*)b;
+    return (x > y) - (x < y);
+}
+
+// --- system malloc ---
+static void sys_init(size_t max_size) { (void)max_size; }
+static void* sys_alloc(size_t size) { return malloc(size); }
+static void sys_release(void *p, size_t size) { (void)size; free(p); }
+
+// glibc reports the total free bytes of the main heap. The largest hole is
+// probed: binary-search the biggest request malloc can place entirely
+// inside the heap as it was before probing.
+static void sys_free_stats(size_t *total, size_t *largest) {
+    struct mallinfo2 mi = mallinfo2();
+    char *heap_end = sbrk(0), *heap_start = heap_end - mi.arena;
+    *total = mi.fordblks;
+    mallopt(M_MMAP_THRESHOLD, 512 * 1024 * 1024);   // keep probes inside the heap
+    size_t lo = 0, hi = mi.fordblks;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo + 1) / 2;
+        char *p = malloc(mid);
+        int fits = p && p >= heap_start && p + mid <= heap_end;
+        free(p);
+        if (fits) lo = mid; else hi = mid - 1;
     }
-    // Now try to allocate a large block
-    void *big = malloc(500);
-    if (!big) {
-        printf("Failed to allocate 500 bytes — external fragmentation!\n");
-    } else {
-        printf("Allocated 500 bytes successfully\n");
-        free(big);
+    *largest = lo;
+}
+
+// --- fixed-size pool (slot = largest size in the trace) ---
+typedef struct FreeNode { struct FreeNode *next; } FreeNode;
+
+typedef struct {
+    size_t slot;
+    size_t per_chunk;
+    FreeNode *free_list;
+} Pool;
+
+static void pool_setup(Pool *p, size_t slot, size_t chunk_bytes) {
+    p->slot = (slot + 15) & ~(size_t)15;
+    p->per_chunk = chunk_bytes / p->slot ? chunk_bytes / p->slot : 1;
+    p->free_list = NULL;
+}
+
+static void* pool_take(Pool *p) {
+    if (!p->free_list) {
+        char *chunk = malloc(p->slot * p->per_chunk);
+        if (!chunk) return NULL;
+        for (size_t i = p->per_chunk; i-- > 0; ) {
+            FreeNode *n = (FreeNode*)(chunk + i * p->slot);
+            n->next = p->free_list;
+            p->free_list = n;
+        }
+    }
+    FreeNode *n = p->free_list;
+    p->free_list = n->next;
+    return n;
+}
+
+static void pool_give(Pool *p, void *ptr) {
+    FreeNode *n = ptr;
+    n->next = p->free_list;
+    p->free_list = n;
+}
+
+// Sum the free list and find the longest run of address-adjacent free slots
+static void pool_stats(const Pool *p, size_t *total, size_t *largest) {
+    size_t count = 0;
+    for (FreeNode *n = p->free_list; n; n = n->next) count++;
+    if (!count) return;
+    void **slots = malloc(count * sizeof(void*));
+    size_t i = 0;
+    for (FreeNode *n = p->free_list; n; n = n->next) slots[i++] = n;
+    qsort(slots, count, sizeof(void*), cmp_ptr);
+    size_t run = p->slot;
+    for (i = 0; i < count; i++) {
+        if (i && (char*)slots[i] == (char*)slots[i - 1] + p->slot) run += p->slot;
+        else run = p->slot;
+        if (run > *largest) *largest = run;
+    }
+    *total += count * p->slot;
+    free(slots);
+}
+
+static Pool the_pool;
+static void pool_init(size_t max_size) { pool_setup(&the_pool, max_size, 64 * 1024); }
+static void* pool_alloc(size_t size) { (void)size; return pool_take(&the_pool); }
+static void pool_release(void *p, size_t size) { (void)size; pool_give(&the_pool, p); }
+static void pool_free_stats(size_t *total, size_t *largest) {
+    *total = *largest = 0;
+    pool_stats(&the_pool, total, largest);
+}
+
+// --- slab: one pool per power-of-two size class, 8..2048, malloc above ---
+#define SLAB_CLASSES 9
+static Pool slab_classes[SLAB_CLASSES];
+
+static int slab_class(size_t size) {
+    int c = 0;
+    while (((size_t)8 << c) < size) c++;
+    return c;
+}
+
+static void slab_init(size_t max_size) {
+    (void)max_size;
+    for (int c = 0; c < SLAB_CLASSES; c++)
+        pool_setup(&slab_classes[c], (size_t)8 << c, 64 * 1024);
+}
+static void* slab_alloc(size_t size) {
+    int c = slab_class(size);
+    return c < SLAB_CLASSES ? pool_take(&slab_classes[c]) : malloc(size);
+}
+static void slab_release(void *p, size_t size) {
+    int c = slab_class(size);
+    if (c < SLAB_CLASSES) pool_give(&slab_classes[c], p);
+    else free(p);
+}
+static void slab_free_stats(size_t *total, size_t *largest) {
+    *total = *largest = 0;
+    for (int c = 0; c < SLAB_CLASSES; c++)
+        pool_stats(&slab_classes[c], total, largest);
+}
+
+// --- arena: bump allocation, frees are no-ops until the arena is reset ---
+#define ARENA_BLOCK (1024 * 1024)
+static char *arena_cur, *arena_end;
+static size_t arena_dead;           // bytes freed by the program but not reusable
+
+static void arena_init(size_t max_size) { (void)max_size; arena_cur = arena_end = NULL; arena_dead = 0; }
+static void* arena_alloc(size_t size) {
+    size = (size + 15) & ~(size_t)15;
+    if (!arena_cur || arena_cur + size > arena_end) {
+        size_t cap = size > ARENA_BLOCK ? size : ARENA_BLOCK;
+        arena_cur = malloc(cap);
+        if (!arena_cur) return NULL;
+        arena_end = arena_cur + cap;
+    }
+    void *p = arena_cur;
+    arena_cur += size;
+    return p;
+}
+static void arena_release(void *p, size_t size) { (void)p; arena_dead += (size + 15) & ~(size_t)15; }
+static void arena_free_stats(size_t *total, size_t *largest) {
+    // Only the tail of the current block can satisfy new requests
+    *largest = arena_end - arena_cur;
+    *total = *largest + arena_dead;
+}
+
+static const Allocator allocators[] = {
+    { "malloc", sys_init,   sys_alloc,   sys_release,   sys_free_stats   },
+    { "pool",   pool_init,  pool_alloc,  pool_release,  pool_free_stats  },
+    { "slab",   slab_init,  slab_alloc,  slab_release,  slab_free_stats  },
+    { "arena",  arena_init, arena_alloc, arena_release, arena_free_stats },
+};
+
+// ---------------- Harness ----------------
+
+typedef struct {
+    double seconds;
+    long rss_growth_kb;
+    size_t total_free, largest_free;
+    int failed;
+} Result;
+
+static long rss_kb(void) {
+    long pages = 0, resident = 0;
+    FILE *fp = fopen("/proc/self/statm", "r");
+    if (fp) { if (fscanf(fp, "%ld %ld", &pages, &resident) != 2) resident = 0; fclose(fp); }
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+// Forget the peak inherited from the parent (Linux: "5" resets VmHWM)
+static void reset_peak_rss(void) {
+    FILE *fp = fopen("/proc/self/clear_refs", "w");
+    if (fp) { fputs("5", fp); fclose(fp); }
+}
+
+static long peak_rss_kb(void) {
+    char line[256];
+    long kb = 0;
+    FILE *fp = fopen("/proc/self/status", "r");
+    if (!fp) return 0;
+    while (fgets(line, sizeof line, fp))
+        if (sscanf(line, "VmHWM: %ld", &kb) == 1) break;
+    fclose(fp);
+    return kb;
+}
+
+static Result replay(const Allocator *a, const Trace *t) {
+    Result r = {0};
+    // Bookkeeping comes pre-faulted from mmap, so it doesn't count as growth
+    size_t book = t->num_ids * (sizeof(void*) + sizeof(size_t));
+    char *mem = mmap(NULL, book ? book : 1, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (mem == MAP_FAILED) { r.failed = 1; return r; }
+    void **ptr = (void**)mem;
+    size_t *size = (size_t*)(mem + t->num_ids * sizeof(void*));
+    reset_peak_rss();
+    long rss_before = rss_kb();
+    a->init(t->max_size);
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (size_t i = 0; i < t->n; i++) {
+        const TraceOp *op = &t->ops[i];
+        if (op->op == 'a') {
+            ptr[op->id] = a->alloc(op->size);
+            if (!ptr[op->id]) { r.failed++; continue; }
+            size[op->id] = op->size;
+            memset(ptr[op->id], 0x5A, op->size < 64 ? op->size : 64);   // touch it
+        } else if (ptr[op->id]) {
+            a->release(ptr[op->id], size[op->id]);
+            ptr[op->id] = NULL;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    r.seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    r.rss_growth_kb = peak_rss_kb() - rss_before;
+
+    // Fragmentation snapshot with the trace's final live set still allocated
+    a->free_stats(&r.total_free, &r.largest_free);
+    return r;                       // the child process exits; no cleanup needed
+}
+
+static void run_trace(const Trace *t) {
+    printf("\nTrace: %s — %zu ops\n", t->name, t->n);
+    printf("%-8s %12s %12s %12s %12s %8s\n",
+           "alloc", "Mops/s", "peakRSS KB", "free KB", "largest KB", "ratio");
+    for (size_t i = 0; i < sizeof(allocators) / sizeof(allocators[0]); i++) {
+        int fd[2];
+        if (pipe(fd) != 0) { perror("pipe"); return; }
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid == 0) {
+            close(fd[0]);
+            Result r = replay(&allocators[i], t);
+            if (write(fd[1], &r, sizeof r) != sizeof r) _exit(1);
+            _exit(0);
+        }
+        close(fd[1]);
+        Result r;
+        ssize_t got = read(fd[0], &r, sizeof r);
+        close(fd[0]);
+        waitpid(pid, NULL, 0);
+        if (got != sizeof r) { printf("%-8s (crashed)\n", allocators[i].name); continue; }
+
+        double ratio = r.total_free ? (double)r.largest_free / r.total_free : 1.0;
+        printf("%-8s %12.1f %12ld %12.1f %12.1f %8.2f%s\n", allocators[i].name,
+               t->n / r.seconds / 1e6, r.rss_growth_kb, r.total_free / 1024.0,
+               r.largest_free / 1024.0, ratio, r.failed ? "  (allocation failures)" : "");
+    }
+}
+
+int main(int argc, char *argv[]) {
+    // A fixed threshold keeps the big trace arrays in mmap'd memory,
+    // so the forked children start with a clean heap
+    mallopt(M_MMAP_THRESHOLD, 128 * 1024);
+
+    if (argc >= 3 && strcmp(argv[1], "replay") == 0) {
+        Trace t = { .name = argv[2] };
+        if (trace_load(&t, argv[2]) != 0) return 1;
+        run_trace(&t);
+        return 0;
     }
-    // Cleanup remaining
-    for (int i = 1; i < NUM; i += 2) {
-        free(ptrs[i]);
+    if (argc >= 4 && strcmp(argv[1], "generate") == 0) {
+        // each allocation gets its own id, so N is bounded by what replay accepts
+        char *end;
+        errno = 0;
+        long n = strtol(argv[3], &end, 10);
+        if (errno || end == argv[3] || *end || n < 1 || n > (long)TRACE_MAX_IDS) {
+            fprintf(stderr, "generate: N must be a number from 1 to %u\n", TRACE_MAX_IDS);
+            return 1;
+        }
+        Trace t = synthetic_trace("generated", SIZES_LOGNORMAL, 2000, (unsigned)n, 1);
+        return trace_save(&t, argv[2]) == 0 ? 0 : 1;
     }
+
+    Trace classic = classic_trace();
+    run_trace(&classic);
+
+    Trace small = synthetic_trace("small objects 8..64 B, mean life 1000",
+                                  SIZES_SMALL, 1000, 1000000, 1);
+    Trace mixed = synthetic_trace("lognormal sizes, mean life 5000",
+                                  SIZES_LOGNORMAL, 5000, 1000000, 2);
+    Trace bimodal = synthetic_trace("bimodal 16-32 B / 1-2 KB, mean life 2000",
+                                    SIZES_BIMODAL, 2000, 1000000, 3);
+    run_trace(&small);
+    run_trace(&mixed);
+    run_trace(&bimodal);
+    printf("\nratio = largest contiguous free / total free (1.00 = no fragmentation)\n");
     return 0;
-}
\ No newline at end of file
+}
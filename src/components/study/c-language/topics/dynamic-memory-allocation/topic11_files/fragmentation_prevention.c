@@ -1,55 +1,235 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
 
-// Simple fixed-size pool for objects of size 32 bytes
-#define POOL_SIZE 100
-#define OBJECT_SIZE 32
+// Fixed-size pool allocator with an intrusive free list.
+// Every free slot stores a pointer to the next free slot inside itself,
+// so pool_alloc() and pool_free() are O(1) — no scanning for "used == 0".
+// When the pool runs out, a new chunk is allocated and threaded onto the list.
+
+#define DEFAULT_OBJECTS_PER_CHUNK 1024
+
+typedef struct FreeNode {
+    struct FreeNode *next;
+} FreeNode;
+
+typedef struct Chunk {
+    struct Chunk *next;          // chunk list, walked by pool_destroy() (and debug checks)
+#ifndef NDEBUG
+    // Debug builds: one "on the free list" bit per slot. It lives here,
+    // outside the slots, so nothing a caller stores in an object can be
+    // mistaken for it.
+    unsigned char free_bits[];
+#endif
+} Chunk;
 
 typedef struct {
-    char data[OBJECT_SIZE];
-    int used;
-} PoolObject;
+    size_t obj_size;             // slot size (rounded up to alignment)
+    size_t align;                // power of two
+    size_t per_chunk;            // slots per chunk
+    size_t data_offset;          // offset of the first slot inside a chunk
+    FreeNode *free_list;
+    Chunk *chunks;
+    size_t num_chunks;
+} Pool;
+
+static size_t round_up(size_t n, size_t align) {
+    return (n + align - 1) & ~(align - 1);
+}
 
-PoolObject pool[POOL_SIZE];
+// obj_size: bytes per object, align: power of two (0 = default),
+// per_chunk: how many objects each new chunk holds (0 = default)
+int pool_init(Pool *p, size_t obj_size, size_t align, size_t per_chunk) {
+    if (align == 0) align = sizeof(void*);
+    if (align & (align - 1)) return -1;              // not a power of two
+    if (align < _Alignof(FreeNode)) align = _Alignof(FreeNode);
+    if (obj_size < sizeof(FreeNode)) obj_size = sizeof(FreeNode);
 
-void* pool_alloc() {
-    for (int i = 0; i < POOL_SIZE; i++) {
-        if (!pool[i].used) {
-            pool[i].used = 1;
-            return &pool[i];
-        }
+    p->align = align;
+    p->obj_size = round_up(obj_size, align);
+    p->per_chunk = per_chunk ? per_chunk : DEFAULT_OBJECTS_PER_CHUNK;
+    size_t header = sizeof(Chunk);
+#ifndef NDEBUG
+    header += (p->per_chunk + 7) / 8;
+#endif
+    p->data_offset = round_up(header, align);
+    p->free_list = NULL;
+    p->chunks = NULL;
+    p->num_chunks = 0;
+    return 0;
+}
+
+#ifndef NDEBUG
+// Find the chunk and slot index of ptr; NULL if ptr is not a slot of this pool.
+// O(number of chunks), debug builds only.
+static Chunk* slot_of(Pool *p, void *ptr, size_t *slot) {
+    for (Chunk *c = p->chunks; c; c = c->next) {
+        char *base = (char*)c + p->data_offset;
+        if ((char*)ptr < base || (char*)ptr >= base + p->obj_size * p->per_chunk)
+            continue;
+        size_t off = (size_t)((char*)ptr - base);
+        if (off % p->obj_size) return NULL;         // points into the middle of a slot
+        *slot = off / p->obj_size;
+        return c;
     }
     return NULL;
 }
 
-void pool_free(void *p) {
-    PoolObject *obj = (PoolObject*)p;
-    obj->used = 0;
+static int is_free(Chunk *c, size_t slot) { return c->free_bits[slot / 8] >> (slot % 8) & 1; }
+static void mark(Chunk *c, size_t slot, int free_now) {
+    if (free_now) c->free_bits[slot / 8] |= (unsigned char)(1u << (slot % 8));
+    else          c->free_bits[slot / 8] &= (unsigned char)~(1u << (slot % 8));
+}
+#endif
+
+// Allocate one more chunk and push all of its slots onto the free list
+static int pool_grow(Pool *p) {
+    size_t bytes = p->data_offset + p->obj_size * p->per_chunk;
+    Chunk *c = aligned_alloc(p->align, round_up(bytes, p->align));
+    if (!c) return -1;
+    c->next = p->chunks;
+#ifndef NDEBUG
+    memset(c->free_bits, 0xFF, (p->per_chunk + 7) / 8);   // every slot starts free
+#endif
+    p->chunks = c;
+    p->num_chunks++;
+
+    // Thread slots back-to-front so allocation hands them out in address order
+    char *base = (char*)c + p->data_offset;
+    for (size_t i = p->per_chunk; i-- > 0; ) {
+        FreeNode *n = (FreeNode*)(base + i * p->obj_size);
+        n->next = p->free_list;
+        p->free_list = n;
+    }
+    return 0;
+}
+
+void* pool_alloc(Pool *p) {
+    if (!p->free_list && pool_grow(p) != 0)
+        return NULL;
+    FreeNode *n = p->free_list;
+    p->free_list = n->next;
+#ifndef NDEBUG
+    size_t slot = 0;
+    Chunk *c = slot_of(p, n, &slot);
+    mark(c, slot, 0);
+#endif
+    return n;
+}
+
+void pool_free(Pool *p, void *ptr) {
+    if (!ptr) return;
+    FreeNode *n = ptr;
+#ifndef NDEBUG
+    // Debug builds: catch the most common misuses — freeing the same slot
+    // twice, or a pointer this pool never handed out
+    size_t slot = 0;
+    Chunk *c = slot_of(p, ptr, &slot);
+    if (!c) {
+        fprintf(stderr, "pool_free: %p is not an object from this pool\n", ptr);
+        abort();
+    }
+    if (is_free(c, slot)) {
+        fprintf(stderr, "pool_free: double free detected at %p\n", ptr);
+        abort();
+    }
+    mark(c, slot, 1);
+#endif
+    n->next = p->free_list;
+    p->free_list = n;
+}
+
+void pool_destroy(Pool *p) {
+    Chunk *c = p->chunks;
+    while (c) {
+        Chunk *next = c->next;
+        free(c);
+        c = next;
+    }
+    p->chunks = NULL;
+    p->free_list = NULL;
+    p->num_chunks = 0;
+}
+
+// ---------------- Benchmark: pool vs malloc ----------------
+
+#define OBJECT_SIZE 32
+#define BENCH_PAIRS 10000000L
+#define BENCH_LIVE  64           // objects kept alive at once (realistic churn)
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void bench(void) {
+    void *live[BENCH_LIVE] = {0};
+    double t0, t_pool, t_malloc;
+
+    Pool p;
+    pool_init(&p, OBJECT_SIZE, 16, 0);
+    t0 = now_sec();
+    for (long i = 0; i < BENCH_PAIRS; i++) {
+        int k = (int)(i % BENCH_LIVE);
+        pool_free(&p, live[k]);
+        live[k] = pool_alloc(&p);
+        *(volatile char*)live[k] = (char)i;
+    }
+    t_pool = now_sec() - t0;
+    for (int k = 0; k < BENCH_LIVE; k++) { pool_free(&p, live[k]); live[k] = NULL; }
+    pool_destroy(&p);
+
+    t0 = now_sec();
+    for (long i = 0; i < BENCH_PAIRS; i++) {
+        int k = (int)(i % BENCH_LIVE);
+        free(live[k]);
+        live[k] = malloc(OBJECT_SIZE);
+        *(volatile char*)live[k] = (char)i;
+    }
+    t_malloc = now_sec() - t0;
+    for (int k = 0; k < BENCH_LIVE; k++) free(live[k]);
+
+    printf("\n%ld alloc/free pairs of %d bytes:\n", BENCH_PAIRS, OBJECT_SIZE);
+    printf("  pool   : %.3f s (%.1f ns/pair)\n", t_pool, t_pool * 1e9 / BENCH_PAIRS);
+    printf("  malloc : %.3f s (%.1f ns/pair)\n", t_malloc, t_malloc * 1e9 / BENCH_PAIRS);
 }
 
 int main() {
-    // Allocate many objects from pool
+    Pool pool;
+    // 32-byte objects, 16-byte aligned, small chunks so growth is visible
+    pool_init(&pool, OBJECT_SIZE, 16, 16);
+
+    // Allocate many objects from pool — it grows chunk by chunk
     void *objects[50];
     for (int i = 0; i < 50; i++) {
-        objects[i] = pool_alloc();
+        objects[i] = pool_alloc(&pool);
         if (!objects[i]) {
             printf("Pool allocation failed at %d\n", i);
-            break;
+            return 1;
         }
     }
+    printf("Allocated 50 objects using %zu chunks\n", pool.num_chunks);
+
     // Free some in arbitrary order (no fragmentation in the pool)
     for (int i = 0; i < 50; i += 2) {
-        pool_free(objects[i]);
+        pool_free(&pool, objects[i]);
     }
-    // Allocate again — pool still works
-    void *new_obj = pool_alloc();
+    // Allocate again — O(1), reuses the most recently freed slot
+    void *new_obj = pool_alloc(&pool);
     if (new_obj) {
         printf("Pool reallocation successful — no external fragmentation.\n");
-        pool_free(new_obj);
+        printf("Reused slot: %s\n", new_obj == objects[48] ? "yes" : "no");
+        pool_free(&pool, new_obj);
     }
     // Cleanup
     for (int i = 1; i < 50; i += 2) {
-        pool_free(objects[i]);
+        pool_free(&pool, objects[i]);
     }
+    pool_destroy(&pool);
+
+    bench();
     return 0;
-}
\ No newline at end of file
+}
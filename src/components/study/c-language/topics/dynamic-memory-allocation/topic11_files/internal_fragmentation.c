@@ -1,25 +1,183 @@
+#define _DEFAULT_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <sys/mman.h>
+
+// Size-class slab allocator.
+// Requests are rounded up to the next size class (8, 16, 32, ..., 2048).
+// Each class carves objects out of 64 KB slabs obtained from mmap.
+// Objects carry no header: the slab descriptor sits at the start of the
+// slab, and since slabs are 64 KB aligned, masking any object pointer
+// finds it. The gap between requested and class size is the internal
+// fragmentation, and we count it per class.
+
+#define SLAB_SIZE   (64 * 1024)
+#define MIN_SHIFT   3                       // 8 bytes
+#define MAX_SHIFT   11                      // 2048 bytes
+#define NUM_CLASSES (MAX_SHIFT - MIN_SHIFT + 1)
+
+typedef struct FreeObj {
+    struct FreeObj *next;
+} FreeObj;
+
+typedef struct Slab {
+    struct Slab *next;          // next slab of the same class
+    int cls;
+    unsigned used;              // live objects in this slab
+} Slab;
+
+typedef struct {
+    size_t obj_size;
+    FreeObj *free_list;
+    Slab *slabs;
+    size_t num_slabs;
+    // statistics
+    size_t allocs;
+    size_t bytes_requested;     // sum of sizes asked for
+    size_t bytes_reserved;      // sum of class sizes handed out
+} SizeClass;
+
+static SizeClass classes[NUM_CLASSES];
+
+static int size_to_class(size_t size) {
+    if (size <= 8) return 0;
+    // index of the highest set bit of (size - 1), plus one
+    int shift = 64 - __builtin_clzll((unsigned long long)(size - 1));
+    return shift - MIN_SHIFT;
+}
+
+// mmap returns page-aligned memory; over-map and trim to get SLAB_SIZE alignment
+static void* map_aligned_slab(void) {
+    size_t len = 2 * SLAB_SIZE;
+    char *raw = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return NULL;
+    uintptr_t start = ((uintptr_t)raw + SLAB_SIZE - 1) & ~(uintptr_t)(SLAB_SIZE - 1);
+    size_t head = start - (uintptr_t)raw;
+    if (head) munmap(raw, head);
+    munmap((char*)start + SLAB_SIZE, len - head - SLAB_SIZE);
+    return (void*)start;
+}
+
+static int slab_grow(SizeClass *sc, int cls) {
+    Slab *s = map_aligned_slab();
+    if (!s) return -1;
+    s->cls = cls;
+    s->used = 0;
+    s->next = sc->slabs;
+    sc->slabs = s;
+    sc->num_slabs++;
+
+    // First object starts after the descriptor, aligned to the object size
+    // (capped at 16 so the small classes don't lose a whole slot)
+    size_t align = sc->obj_size < 16 ? sc->obj_size : 16;
+    size_t first = (sizeof(Slab) + align - 1) & ~(align - 1);
+    char *base = (char*)s + first;
+    size_t count = (SLAB_SIZE - first) / sc->obj_size;
+    for (size_t i = count; i-- > 0; ) {
+        FreeObj *o = (FreeObj*)(base + i * sc->obj_size);
+        o->next = sc->free_list;
+        sc->free_list = o;
+    }
+    return 0;
+}
 
-// Simulate a simple allocator with alignment to 8 bytes
 void* my_malloc(size_t size) {
-    // For demonstration, round up to multiple of 8 (minimum 16 for header?)
-    // Actually, just show the effect: allocate 8 bytes more than requested.
-    size_t aligned = (size + 7) & ~7;
-    return malloc(aligned);
+    if (size == 0) size = 1;
+    if (size > ((size_t)1 << MAX_SHIFT))
+        return malloc(size);                // large objects: general-purpose heap
+
+    int cls = size_to_class(size);
+    SizeClass *sc = &classes[cls];
+    if (sc->obj_size == 0) sc->obj_size = (size_t)1 << (cls + MIN_SHIFT);
+    if (!sc->free_list && slab_grow(sc, cls) != 0)
+        return NULL;
+
+    FreeObj *o = sc->free_list;
+    sc->free_list = o->next;
+    ((Slab*)((uintptr_t)o & ~(uintptr_t)(SLAB_SIZE - 1)))->used++;
+
+    sc->allocs++;
+    sc->bytes_requested += size;
+    sc->bytes_reserved += sc->obj_size;
+    return o;
+}
+
+// Sized free: the caller passes the size it asked for, exactly like the
+// object's lifetime owner always knows it. This keeps objects header-free.
+void my_free(void *p, size_t size) {
+    if (!p) return;
+    if (size > ((size_t)1 << MAX_SHIFT)) {
+        free(p);
+        return;
+    }
+    Slab *s = (Slab*)((uintptr_t)p & ~(uintptr_t)(SLAB_SIZE - 1));
+    SizeClass *sc = &classes[s->cls];
+    FreeObj *o = p;
+    o->next = sc->free_list;
+    sc->free_list = o;
+    s->used--;
+}
+
+void slab_report(void) {
+    printf("\n%-6s %8s %6s %12s %12s %8s\n",
+           "class", "allocs", "slabs", "requested", "reserved", "waste");
+    size_t total_req = 0, total_res = 0;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        SizeClass *sc = &classes[i];
+        if (sc->allocs == 0) continue;
+        double waste = 100.0 * (sc->bytes_reserved - sc->bytes_requested) / sc->bytes_reserved;
+        printf("%-6zu %8zu %6zu %12zu %12zu %7.1f%%\n", sc->obj_size, sc->allocs,
+               sc->num_slabs, sc->bytes_requested, sc->bytes_reserved, waste);
+        total_req += sc->bytes_requested;
+        total_res += sc->bytes_reserved;
+    }
+    if (total_res)
+        printf("Total: %zu requested, %zu reserved -> %.1f%% internal fragmentation\n",
+               total_req, total_res, 100.0 * (total_res - total_req) / total_res);
+}
+
+void slab_release_all(void) {
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        Slab *s = classes[i].slabs;
+        while (s) {
+            Slab *next = s->next;
+            munmap(s, SLAB_SIZE);
+            s = next;
+        }
+        classes[i].slabs = NULL;
+        classes[i].free_list = NULL;
+        classes[i].num_slabs = 0;
+    }
 }
 
 int main() {
-    // Request various sizes and see the actual allocated space (if we could)
-    // This example just illustrates the concept.
-    size_t requests[] = {1, 5, 8, 9, 16, 17};
-    for (int i = 0; i < 6; i++) {
+    // Request various sizes and see which size class each one lands in
+    size_t requests[] = {1, 5, 8, 9, 16, 17, 100, 1025};
+    int n = sizeof(requests) / sizeof(requests[0]);
+    for (int i = 0; i < n; i++) {
         void *p = my_malloc(requests[i]);
-        printf("Requested %zu bytes, pointer %p\n", requests[i], p);
-        free(p);
+        printf("Requested %4zu bytes -> class %4d bytes, pointer %p\n",
+               requests[i], 1 << (size_to_class(requests[i]) + MIN_SHIFT), p);
+        my_free(p, requests[i]);
+    }
+
+    // A small-object-heavy workload: many short strings / nodes of mixed sizes
+    enum { COUNT = 100000 };
+    static void *ptrs[COUNT];
+    static size_t sizes[COUNT];
+    srand(42);
+    for (int i = 0; i < COUNT; i++) {
+        sizes[i] = 1 + rand() % 200;
+        ptrs[i] = my_malloc(sizes[i]);
+    }
+    for (int i = 0; i < COUNT; i++) {
+        my_free(ptrs[i], sizes[i]);
     }
-    // In reality, you can't see the internal fragmentation directly,
-    // but you can infer it by measuring memory usage.
-    printf("\nInternal fragmentation: wasted space due to alignment and metadata.\n");
+
+    // Now we can actually *see* the internal fragmentation
+    slab_report();
+    slab_release_all();
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,256 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+// Allocation-trace recorder: the "record" half of external_fragmentation.c.
+// Preload it into any program and every malloc/calloc/realloc/free is
+// written out as a trace that `./frag replay` accepts:
+//   "a <id> <size>"   allocation
+//   "f <id>"          free
+// realloc becomes a free of the old id plus an allocation of a new one.
+//
+// Build and use:
+//   gcc -O2 -shared -fPIC -o libtrace.so trace_recorder.c -ldl -pthread
+//   TRACE_OUT=app.trace LD_PRELOAD=./libtrace.so ./app
+//   ./frag replay app.trace
+//
+// Ids are small integers recycled as blocks are freed, so they stay within
+// the replay's id cap as long as the program has fewer live blocks than
+// that. The recorder itself must never call malloc: the pointer table and
+// the id stack are mmap'd, output goes through write(), and a per-thread
+// flag passes nested calls (from dlsym, or from libc inside a hook)
+// straight to the real allocator. A forked child stops recording, so only
+// the original process writes the trace. Blocks from memalign and
+// posix_memalign are not recorded, and neither are their frees.
+
+#define MAX_IDS     (1u << 24)      // same cap as TRACE_MAX_IDS in the replayer
+#define TABLE_SLOTS (1u << 25)      // pointer -> id, kept at most half full
+#define OUT_BUF     (64 * 1024)
+
+typedef struct {
+    void *ptr;                      // NULL = empty slot
+    unsigned id;
+} Entry;
+
+static void* (*real_malloc)(size_t);
+static void* (*real_calloc)(size_t, size_t);
+static void* (*real_realloc)(void*, size_t);
+static void  (*real_free)(void*);
+
+static Entry *table;
+static unsigned *free_ids;          // stack of ids ready for reuse
+static size_t n_free_ids;
+static unsigned next_id;
+static int out_fd = -1;
+static char out[OUT_BUF];
+static size_t out_len;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread int in_recorder __attribute__((tls_model("initial-exec")));
+
+// dlsym may allocate before the real functions are known; serve it from here
+static char boot_heap[4096];
+static size_t boot_used;
+
+static int from_boot_heap(void *p) {
+    return (char*)p >= boot_heap && (char*)p < boot_heap + sizeof boot_heap;
+}
+
+static void* boot_alloc(size_t size) {
+    size = (size + 15) & ~(size_t)15;
+    if (size > sizeof boot_heap - boot_used) return NULL;
+    void *p = boot_heap + boot_used;
+    boot_used += size;
+    return p;                       // static storage: already zeroed
+}
+
+// ---------------- Output ----------------
+
+static void flush_out(void) {
+    size_t done = 0;
+    while (done < out_len) {
+        ssize_t w = write(out_fd, out + done, out_len - done);
+        if (w <= 0) break;          // disk full etc.: drop the rest
+        done += (size_t)w;
+    }
+    out_len = 0;
+}
+
+static void put_uint(unsigned long long v) {
+    char digits[20];
+    int n = 0;
+    do { digits[n++] = (char)('0' + v % 10); v /= 10; } while (v);
+    while (n) out[out_len++] = digits[--n];
+}
+
+// One trace line; size is ignored for frees
+static void emit(char op, unsigned id, size_t size) {
+    if (out_len > OUT_BUF - 64) flush_out();
+    out[out_len++] = op;
+    out[out_len++] = ' ';
+    put_uint(id);
+    if (op == 'a') {
+        out[out_len++] = ' ';
+        put_uint(size);
+    }
+    out[out_len++] = '\n';
+}
+
+// ---------------- Pointer -> id table (linear probing) ----------------
+
+static size_t slot_of(const void *p) {
+    uintptr_t h = (uintptr_t)p >> 4;
+    return (size_t)((h * 0x9E3779B97F4A7C15ull) >> 39) & (TABLE_SLOTS - 1);
+}
+
+static void table_put(void *p, unsigned id) {
+    size_t i = slot_of(p);
+    while (table[i].ptr) i = (i + 1) & (TABLE_SLOTS - 1);
+    table[i] = (Entry){ p, id };
+}
+
+// Remove p and return its id, or -1 if p was never recorded.
+// Backward-shift deletion keeps probe chains intact without tombstones.
+static long table_take(void *p) {
+    size_t i = slot_of(p);
+    while (table[i].ptr != p) {
+        if (!table[i].ptr) return -1;
+        i = (i + 1) & (TABLE_SLOTS - 1);
+    }
+    unsigned id = table[i].id;
+    for (size_t j = (i + 1) & (TABLE_SLOTS - 1); table[j].ptr; j = (j + 1) & (TABLE_SLOTS - 1)) {
+        size_t home = slot_of(table[j].ptr);
+        // move j back into the hole at i unless its home lies in (i, j]
+        if (((j - home) & (TABLE_SLOTS - 1)) >= ((j - i) & (TABLE_SLOTS - 1))) {
+            table[i] = table[j];
+            i = j;
+        }
+    }
+    table[i].ptr = NULL;
+    return id;
+}
+
+// ---------------- Recording ----------------
+
+static void record_alloc(void *p, size_t size) {
+    pthread_mutex_lock(&lock);
+    unsigned id = n_free_ids ? free_ids[--n_free_ids] : next_id;
+    if (id < MAX_IDS) {
+        if (id == next_id) next_id++;
+        table_put(p, id);
+        emit('a', id, size);
+    }                               // beyond the cap: left out of the trace
+    pthread_mutex_unlock(&lock);
+}
+
+static void record_free(void *p) {
+    pthread_mutex_lock(&lock);
+    long id = table_take(p);
+    if (id >= 0) {
+        free_ids[n_free_ids++] = (unsigned)id;
+        emit('f', (unsigned)id, 0);
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+static void flush_at_exit(void) {
+    pthread_mutex_lock(&lock);
+    if (out_fd >= 0) flush_out();
+    pthread_mutex_unlock(&lock);
+}
+
+static void stop_in_child(void) {
+    out_fd = -1;                    // the parent's descriptor and buffer stay the parent's
+    out_len = 0;
+}
+
+// Look up the real allocator; runs on the first call into any hook.
+// Allocations made by dlsym meanwhile come from the boot heap.
+static void resolve(void) {
+    static int resolving;
+    if (resolving) return;
+    resolving = 1;
+    real_malloc  = dlsym(RTLD_NEXT, "malloc");
+    real_calloc  = dlsym(RTLD_NEXT, "calloc");
+    real_realloc = dlsym(RTLD_NEXT, "realloc");
+    real_free    = dlsym(RTLD_NEXT, "free");
+}
+
+__attribute__((constructor))
+static void recorder_init(void) {
+    in_recorder = 1;
+    if (!real_malloc) resolve();
+    const char *path = getenv("TRACE_OUT");
+    table = mmap(NULL, TABLE_SLOTS * sizeof(Entry), PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    free_ids = mmap(NULL, MAX_IDS * sizeof(unsigned), PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (table != MAP_FAILED && free_ids != MAP_FAILED)
+        out_fd = open(path ? path : "alloc.trace", O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (out_fd >= 0) {
+        atexit(flush_at_exit);
+        pthread_atfork(NULL, NULL, stop_in_child);
+    }
+    in_recorder = 0;
+}
+
+// ---------------- Interposed functions ----------------
+
+void* malloc(size_t size) {
+    if (!real_malloc) resolve();
+    if (!real_malloc) return boot_alloc(size);
+    void *p = real_malloc(size);
+    if (p && out_fd >= 0 && !in_recorder) {
+        in_recorder = 1;
+        record_alloc(p, size);
+        in_recorder = 0;
+    }
+    return p;
+}
+
+void* calloc(size_t count, size_t size) {
+    if (!real_calloc) resolve();
+    if (!real_calloc) return size && count > SIZE_MAX / size ? NULL : boot_alloc(count * size);
+    void *p = real_calloc(count, size);
+    if (p && out_fd >= 0 && !in_recorder) {
+        in_recorder = 1;
+        record_alloc(p, count * size);
+        in_recorder = 0;
+    }
+    return p;
+}
+
+void free(void *p) {
+    if (!p || from_boot_heap(p)) return;
+    if (!real_free) resolve();
+    if (out_fd >= 0 && !in_recorder) {
+        in_recorder = 1;
+        record_free(p);
+        in_recorder = 0;
+    }
+    real_free(p);
+}
+
+void* realloc(void *p, size_t size) {
+    if (from_boot_heap(p)) {        // move it onto the real heap
+        size_t room = boot_heap + sizeof boot_heap - (char*)p;  // its size is not kept
+        void *q = malloc(size);
+        if (q) memcpy(q, p, size < room ? size : room);
+        return q;
+    }
+    if (!real_realloc) resolve();
+    if (!real_realloc) return boot_alloc(size);
+    void *q = real_realloc(p, size);
+    if (out_fd >= 0 && !in_recorder && (q || size == 0)) {
+        in_recorder = 1;
+        if (p) record_free(p);      // realloc(p, 0) frees p and may return NULL
+        if (q) record_alloc(q, size);
+        in_recorder = 0;
+    }
+    return q;
+}
@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+// Guarded debug heap — catches the bugs from the Valgrind examples
+// at near-native speed, without running under Valgrind.
+//
+// Block layout:  [header][front red zone][ payload ][rear red zone]
+// - Red zones are filled with a known byte and checked on free.
+// - Freed blocks are poisoned and parked in a FIFO quarantine instead of
+//   being returned to malloc, so stale pointers keep hitting poison.
+//   When a block leaves the quarantine, the poison is verified: any change
+//   means someone wrote through a dangling pointer.
+// - The header records the block state, so a second free is reported.
+// - Blocks still live at exit are counted, so leaks show in the summary.
+//
+// Allocate through the gmalloc/gfree macros (above main) so every
+// report names the file and line of the call. To run the other examples
+// (Valgrind demos, double free, canaries) on this heap instead, build them
+// with -DGUARDED_HEAP together with this file; guarded_heap.h explains how.
+
+#define REDZONE          16
+#define QUARANTINE_SLOTS 1024
+#define REDZONE_BYTE     0xAB
+#define POISON_BYTE      0xFD
+
+#define STATE_LIVE  0x4C495645u     // "LIVE"
+#define STATE_FREED 0x46524545u     // "FREE"
+
+typedef struct {
+    uint32_t state;
+    uint32_t line;
+    size_t size;
+    const char *file;               // where it was allocated
+    const char *free_file;          // where it was freed
+    uint32_t free_line;
+    uint32_t pad[3];
+} GuardHeader;                      // 48 bytes: payload stays 16-byte aligned
+
+static GuardHeader *quarantine[QUARANTINE_SLOTS];
+static size_t q_head;               // next slot to overwrite (oldest entry)
+static size_t errors;
+static size_t live_blocks, live_bytes;
+
+static unsigned char* payload_of(GuardHeader *h) {
+    return (unsigned char*)(h + 1) + REDZONE;
+}
+
+static GuardHeader* header_of(void *p) {
+    return (GuardHeader*)((unsigned char*)p - REDZONE) - 1;
+}
+
+static void report(const char *what, GuardHeader *h, const char *file, int line) {
+    errors++;
+    fprintf(stderr, "[guarded heap] %s: block of %zu bytes allocated at %s:%u",
+            what, h->size, h->file, h->line);
+    if (h->free_file)
+        fprintf(stderr, ", freed at %s:%u", h->free_file, h->free_line);
+    fprintf(stderr, " (detected at %s:%d)\n", file, line);
+}
+
+static int bytes_are(const unsigned char *p, size_t n, unsigned char value) {
+    for (size_t i = 0; i < n; i++)
+        if (p[i] != value) return 0;
+    return 1;
+}
+
+void guarded_heap_finish(void);
+
+void* guarded_malloc(size_t size, const char *file, int line) {
+    static int registered;
+    if (!registered) {
+        registered = 1;
+        atexit(guarded_heap_finish);
+    }
+    if (size > SIZE_MAX - sizeof(GuardHeader) - 2 * REDZONE) return NULL;
+    GuardHeader *h = malloc(sizeof(GuardHeader) + REDZONE + size + REDZONE);
+    if (!h) return NULL;
+    h->state = STATE_LIVE;
+    h->size = size;
+    h->file = file;
+    h->line = (uint32_t)line;
+    h->free_file = NULL;
+    h->free_line = 0;
+    unsigned char *p = payload_of(h);
+    memset(p - REDZONE, REDZONE_BYTE, REDZONE);
+    memset(p + size, REDZONE_BYTE, REDZONE);
+    live_blocks++;
+    live_bytes += size;
+    return p;
+}
+
+void* guarded_calloc(size_t count, size_t size, const char *file, int line) {
+    if (size && count > SIZE_MAX / size) return NULL;
+    void *p = guarded_malloc(count * size, file, line);
+    if (p) memset(p, 0, count * size);
+    return p;
+}
+
+void guarded_free(void *p, const char *file, int line);
+
+// Always moves the block, so the old one goes through the quarantine and a
+// stale pointer into it is caught like any other use after free
+void* guarded_realloc(void *p, size_t size, const char *file, int line) {
+    if (!p) return guarded_malloc(size, file, line);
+    GuardHeader *h = header_of(p);
+    if (h->state != STATE_LIVE) {   // let guarded_free report it
+        guarded_free(p, file, line);
+        return NULL;
+    }
+    void *q = guarded_malloc(size, file, line);
+    if (!q) return NULL;
+    memcpy(q, p, h->size < size ? h->size : size);
+    guarded_free(p, file, line);
+    return q;
+}
+
+// Push a freed block into the quarantine; the oldest one is verified and released
+static void quarantine_push(GuardHeader *h, const char *file, int line) {
+    GuardHeader *old = quarantine[q_head];
+    if (old) {
+        if (!bytes_are(payload_of(old), old->size, POISON_BYTE))
+            report("write after free", old, file, line);
+        free(old);
+    }
+    quarantine[q_head] = h;
+    q_head = (q_head + 1) % QUARANTINE_SLOTS;
+}
+
+void guarded_free(void *p, const char *file, int line) {
+    if (!p) return;
+    GuardHeader *h = header_of(p);
+
+    if (h->state == STATE_FREED) {
+        report("double free", h, file, line);
+        return;                     // never hand the block back twice
+    }
+    if (h->state != STATE_LIVE) {
+        errors++;
+        fprintf(stderr, "[guarded heap] free of pointer %p not from this heap (at %s:%d)\n",
+                p, file, line);
+        return;
+    }
+    if (!bytes_are((unsigned char*)p - REDZONE, REDZONE, REDZONE_BYTE))
+        report("buffer underflow (front red zone overwritten)", h, file, line);
+    if (!bytes_are((unsigned char*)p + h->size, REDZONE, REDZONE_BYTE))
+        report("buffer overflow (rear red zone overwritten)", h, file, line);
+
+    live_blocks--;
+    live_bytes -= h->size;
+    h->state = STATE_FREED;
+    h->free_file = file;
+    h->free_line = (uint32_t)line;
+    memset(p, POISON_BYTE, h->size);
+    quarantine_push(h, file, line);
+}
+
+// Drain the quarantine (verifying every block) and print a summary.
+// Registered with atexit by the first allocation.
+void guarded_heap_finish(void) {
+    for (size_t i = 0; i < QUARANTINE_SLOTS; i++) {
+        GuardHeader *h = quarantine[i];
+        if (!h) continue;
+        if (!bytes_are(payload_of(h), h->size, POISON_BYTE))
+            report("write after free", h, __FILE__, __LINE__);
+        free(h);
+        quarantine[i] = NULL;
+    }
+    if (live_blocks)
+        fprintf(stderr, "[guarded heap] %zu block(s), %zu bytes never freed\n",
+                live_blocks, live_bytes);
+    fprintf(stderr, "[guarded heap] %zu error(s) detected\n", errors);
+}
+
+// ---------------- The three classic bugs ----------------
+// Left out in guarded mode, where the other example supplies main
+
+#ifndef GUARDED_HEAP
+
+#define gmalloc(size) guarded_malloc((size), __FILE__, __LINE__)
+#define gfree(p)      guarded_free((p), __FILE__, __LINE__)
+
+int main() {
+    // 1. Buffer overflow: writing arr[5] of a 5-element array
+    int *arr = gmalloc(5 * sizeof(int));
+    for (int i = 0; i <= 5; i++) arr[i] = i;   // off by one
+    gfree(arr);
+
+    // 2. Use after free: the read sees poison instead of the old value
+    int *p = gmalloc(sizeof(int));
+    *p = 42;
+    gfree(p);
+    printf("Value after free: 0x%X (poison, not 42)\n", (unsigned)*p);
+    *p = 7;                                     // write after free, caught later
+
+    // 3. Double free
+    int *a = gmalloc(10 * sizeof(int));
+    int *b = a;
+    gfree(a);
+    gfree(b);
+
+    return 0;                       // the summary prints at exit
+}
+#endif
@@ -0,0 +1,27 @@
+// guarded_heap.h – opt-in guarded mode for the other memory examples
+#ifndef GUARDED_HEAP_H
+#define GUARDED_HEAP_H
+
+#include <stddef.h>
+#include <stdlib.h>     // real prototypes first, so the macros below only touch calls
+
+void* guarded_malloc(size_t size, const char *file, int line);
+void* guarded_calloc(size_t count, size_t size, const char *file, int line);
+void* guarded_realloc(void *p, size_t size, const char *file, int line);
+void  guarded_free(void *p, const char *file, int line);
+void  guarded_heap_finish(void);    // also runs at exit once anything was allocated
+
+// Guarded mode: build an example with -DGUARDED_HEAP and link guarded_heap.c
+// (which then leaves out its own demo), e.g.
+//   gcc -g -DGUARDED_HEAP valgrind_use_after_free.c guarded_heap.c -o uaf
+// Each example includes this header only under that flag, so its normal
+// build is unchanged. Red zones catch out-of-bounds writes, not reads: an
+// overrunning read sees the 0xAB fill instead of being reported.
+#ifdef GUARDED_HEAP
+#define malloc(size)        guarded_malloc((size), __FILE__, __LINE__)
+#define calloc(count, size) guarded_calloc((count), (size), __FILE__, __LINE__)
+#define realloc(p, size)    guarded_realloc((p), (size), __FILE__, __LINE__)
+#define free(p)             guarded_free((p), __FILE__, __LINE__)
+#endif
+
+#endif
@@ -1,5 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#ifdef GUARDED_HEAP
+#include "guarded_heap.h"   // malloc/free go through the guarded heap
+#endif
 
 int main() {
     int *arr = (int*)malloc(5 * sizeof(int));
@@ -1,5 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#ifdef GUARDED_HEAP
+#include "../topic17_files/guarded_heap.h"   // malloc/free go through the guarded heap
+#endif
 
 // Compile with: gcc -g -fsanitize=address -o double_free double_free.c
 // Run: ./double_free
@@ -1,43 +1,230 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+// Dynamic array with a configurable growth policy.
+// - growth factor is a fraction (3/2 = 1.5x, 2/1 = 2x)
+// - shrinking uses hysteresis: halve only at 1/4 occupancy, so the halved
+//   buffer is still half full. Shrinking at 1/2 instead would reallocate on
+//   every push/pop pair at the boundary (thrashing).
+// - reserve() and shrink_to_fit() give the caller direct control
+// - once the buffer passes mmap_threshold bytes it moves to page-aligned
+//   mmap storage and grows with mremap: the kernel remaps the pages instead
+//   of copying them, so growing a multi-GB array costs almost nothing
+//
+// Usage: ./a.out              capacity sequences, reserve, hysteresis
+//        ./a.out --bench [n]  append n ints (default 2*10^8 = 800 MB),
+//                             realloc only vs mmap/mremap
+
+typedef struct {
+    size_t grow_num, grow_den;      // new_cap = cap * grow_num / grow_den
+    size_t shrink_at;               // halve when size <= cap / shrink_at (0 = never)
+    size_t min_capacity;
+    size_t mmap_threshold;          // bytes; 0 = never use mmap
+} GrowthPolicy;
+
+static const GrowthPolicy GROW_2X   = { 2, 1, 4, 8, 4u << 20 };
+static const GrowthPolicy GROW_1_5X = { 3, 2, 4, 8, 4u << 20 };
 
 typedef struct {
     int *data;
-    int size;
-    int capacity;
+    size_t size;
+    size_t capacity;
+    int mapped;                     // 1 if data lives in an mmap region
+    GrowthPolicy policy;
+    size_t resizes;                 // capacity changes
+    size_t moves;                   // times the elements moved to a new buffer
 } DynArray;
 
-DynArray* dyn_create(int cap) {
+static size_t page_round(size_t bytes) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    return (bytes + page - 1) & ~(page - 1);
+}
+
+// Move the buffer to exactly new_cap elements. Returns 0 on failure.
+static int dyn_set_capacity(DynArray *da, size_t new_cap) {
+    size_t bytes = new_cap * sizeof(int);
+    int want_map = da->policy.mmap_threshold && bytes >= da->policy.mmap_threshold;
+
+    if (want_map) {
+        size_t map_bytes = page_round(bytes);
+        void *p;
+        if (da->mapped) {
+            // Already mapped: remap the pages, no copy (in either direction)
+            p = mremap(da->data, page_round(da->capacity * sizeof(int)), map_bytes, MREMAP_MAYMOVE);
+        } else {
+            // Crossing the threshold: one last copy out of the heap
+            p = mmap(NULL, map_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p != MAP_FAILED) {
+                memcpy(p, da->data, da->size * sizeof(int));
+                free(da->data);
+                da->moves++;
+            }
+        }
+        if (p == MAP_FAILED) return 0;
+        da->data = p;
+        da->mapped = 1;
+        da->capacity = map_bytes / sizeof(int);    // use the whole last page
+        da->resizes++;
+        return 1;
+    }
+
+    if (da->mapped) {
+        // Shrinking back below the threshold: return to the heap
+        int *p = malloc(bytes ? bytes : sizeof(int));
+        if (!p) return 0;
+        memcpy(p, da->data, da->size * sizeof(int));
+        munmap(da->data, page_round(da->capacity * sizeof(int)));
+        da->data = p;
+        da->mapped = 0;
+        da->moves++;
+    } else {
+        int *tmp = realloc(da->data, bytes ? bytes : sizeof(int));
+        if (!tmp) return 0;
+        if (tmp != da->data && da->size) da->moves++;
+        da->data = tmp;
+    }
+    da->capacity = new_cap;
+    da->resizes++;
+    return 1;
+}
+
+DynArray* dyn_create(size_t cap, GrowthPolicy policy) {
     DynArray *da = malloc(sizeof(DynArray));
     if (!da) return NULL;
-    da->data = malloc(cap * sizeof(int));
-    if (!da->data) { free(da); return NULL; }
+    da->data = NULL;
     da->size = 0;
-    da->capacity = cap;
+    da->capacity = 0;
+    da->mapped = 0;
+    da->policy = policy;
+    da->resizes = 0;
+    da->moves = 0;
+    if (cap < policy.min_capacity) cap = policy.min_capacity;
+    if (!dyn_set_capacity(da, cap)) { free(da); return NULL; }
     return da;
 }
 
+// Make sure at least 'cap' elements fit without further growth
+int dyn_reserve(DynArray *da, size_t cap) {
+    return cap <= da->capacity ? 1 : dyn_set_capacity(da, cap);
+}
+
+// Release unused capacity
+int dyn_shrink_to_fit(DynArray *da) {
+    size_t cap = da->size > da->policy.min_capacity ? da->size : da->policy.min_capacity;
+    return cap >= da->capacity ? 1 : dyn_set_capacity(da, cap);
+}
+
 void dyn_append(DynArray *da, int val) {
     if (da->size == da->capacity) {
-        int new_cap = da->capacity * 2; // doubling
-        int *tmp = realloc(da->data, new_cap * sizeof(int));
-        if (!tmp) return;
-        da->data = tmp;
-        da->capacity = new_cap;
+        size_t new_cap = da->capacity * da->policy.grow_num / da->policy.grow_den;
+        if (new_cap <= da->capacity) new_cap = da->capacity + 1;
+        if (!dyn_set_capacity(da, new_cap)) return;
     }
     da->data[da->size++] = val;
 }
 
+int dyn_pop(DynArray *da) {
+    if (da->size == 0) return -1;
+    int val = da->data[--da->size];
+    const GrowthPolicy *p = &da->policy;
+    if (p->shrink_at && da->size <= da->capacity / p->shrink_at &&
+        da->capacity > p->min_capacity) {
+        size_t new_cap = da->capacity / 2;
+        if (new_cap < p->min_capacity) new_cap = p->min_capacity;
+        dyn_set_capacity(da, new_cap);  // on failure just keep the bigger buffer
+    }
+    return val;
+}
+
 void dyn_destroy(DynArray *da) {
-    if (da) { free(da->data); free(da); }
+    if (!da) return;
+    if (da->mapped) munmap(da->data, page_round(da->capacity * sizeof(int)));
+    else free(da->data);
+    free(da);
 }
 
-int main() {
-    DynArray *arr = dyn_create(1);
-    for (int i = 0; i < 100; i++) {
-        dyn_append(arr, i);
-        printf("size=%d, capacity=%d\n", arr->size, arr->capacity);
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Large array: heap realloc vs mmap/mremap growth
+static int run_bench(size_t n) {
+    GrowthPolicy heap_only = GROW_2X;
+    heap_only.mmap_threshold = 0;
+    const GrowthPolicy *big[] = { &heap_only, &GROW_2X };
+    const char *big_names[] = { "realloc only", "mmap/mremap" };
+    for (int p = 0; p < 2; p++) {
+        double t0 = now_sec();
+        DynArray *a = dyn_create(0, *big[p]);
+        if (!a) return 1;
+        for (size_t i = 0; i < n; i++) dyn_append(a, (int)i);
+        printf("%-13s %zu appends: %.2f s, buffer moves: %zu\n",
+               big_names[p], a->size, now_sec() - t0, a->moves);
+        dyn_destroy(a);
     }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+        return run_bench(argc > 2 ? strtoull(argv[2], NULL, 0) : 200u * 1000 * 1000);
+
+    // Watch the capacity sequence under each policy
+    const GrowthPolicy *policies[] = { &GROW_2X, &GROW_1_5X };
+    const char *names[] = { "2x", "1.5x" };
+    for (int p = 0; p < 2; p++) {
+        DynArray *arr = dyn_create(1, *policies[p]);
+        size_t last = 0;
+        printf("%-5s capacities:", names[p]);
+        for (int i = 0; i < 100; i++) {
+            dyn_append(arr, i);
+            if (arr->capacity != last) printf(" %zu", last = arr->capacity);
+        }
+        printf("\n");
+        dyn_destroy(arr);
+    }
+
+    // reserve + shrink_to_fit
+    DynArray *arr = dyn_create(0, GROW_2X);
+    dyn_reserve(arr, 1000);
+    for (int i = 0; i < 600; i++) dyn_append(arr, i);
+    printf("reserve(1000), 600 appends: capacity=%zu\n", arr->capacity);
+    dyn_shrink_to_fit(arr);
+    printf("shrink_to_fit: capacity=%zu\n", arr->capacity);
+    dyn_destroy(arr);
+
+    // Popping shrinks the buffer, but only at 1/4 occupancy
+    arr = dyn_create(8, GROW_2X);
+    for (int i = 0; i < 100; i++) dyn_append(arr, i);
+    printf("After pushes: size=%zu, capacity=%zu\n", arr->size, arr->capacity);
+    for (int i = 0; i < 80; i++) dyn_pop(arr);
+    printf("After pops: size=%zu, capacity=%zu\n", arr->size, arr->capacity);
     dyn_destroy(arr);
+
+    // Alternate push/pop right at a capacity boundary
+    GrowthPolicy naive = GROW_2X;
+    naive.shrink_at = 2;
+    const GrowthPolicy *shrink[] = { &naive, &GROW_2X };
+    const char *shrink_names[] = { "shrink at 1/2", "shrink at 1/4" };
+    for (int p = 0; p < 2; p++) {
+        DynArray *a = dyn_create(8, *shrink[p]);
+        for (int i = 0; i < 64; i++) dyn_append(a, i);      // exactly full
+        a->resizes = 0;
+        for (int i = 0; i < 100000; i++) {
+            dyn_append(a, i);
+            dyn_pop(a);
+            dyn_pop(a);
+            dyn_append(a, i);
+        }
+        printf("%s: %zu resizes for 100000 push/pop rounds\n", shrink_names[p], a->resizes);
+        dyn_destroy(a);
+    }
     return 0;
-}
\ No newline at end of file
+}
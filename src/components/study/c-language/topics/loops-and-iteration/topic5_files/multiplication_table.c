@@ -1,23 +1,109 @@
 /**
  * multiplication_table.c
  *
- * Prints the multiplication table of a given number up to 10.
- * Uses a simple for loop with fixed iteration count.
+ * Prints the multiplication table of a given number up to 10
+ * (or up to the row count given on the command line).
+ * Uses a simple for loop with fixed iteration count; the rows are
+ * formatted into a buffer and written out in one go instead of one
+ * printf per row.
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
-int main() {
+// Buffered output: numbers are formatted by hand into outBuf, and the
+// buffer leaves with a single write() when it fills or on flushOut(),
+// instead of one printf call (format parsing + stream lock) per number.
+static char outBuf[1 << 16];
+static size_t outLen;
+
+static void writeAll(const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t w = write(STDOUT_FILENO, p, len);
+        if (w <= 0) return;
+        p += w;
+        len -= (size_t)w;
+    }
+}
+
+// Text printed with printf is still in stdout's own buffer: it goes first
+static void flushOut(void) {
+    fflush(stdout);
+    writeAll(outBuf, outLen);
+    outLen = 0;
+}
+
+static void writeBytes(const char *s, size_t len) {
+    if (len > sizeof outBuf - outLen) {
+        flushOut();
+        if (len > sizeof outBuf) {
+            writeAll(s, len);
+            return;
+        }
+    }
+    memcpy(outBuf + outLen, s, len);
+    outLen += len;
+}
+
+static void writeChar(char c) {
+    if (outLen == sizeof outBuf) flushOut();
+    outBuf[outLen++] = c;
+}
+
+// "00" "01" ... "99": two digits per division by 100
+static const char DIGIT_PAIRS[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Formats v backwards so that it ends just before 'end'; returns its start
+static char* formatInt(char *end, int v) {
+    char *p = end;
+    unsigned u = v < 0 ? 0u - (unsigned)v : (unsigned)v;
+    while (u >= 100) {
+        unsigned r = u % 100;
+        u /= 100;
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * r, 2);
+    }
+    if (u >= 10) {
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * u, 2);
+    } else {
+        *--p = (char)('0' + u);
+    }
+    if (v < 0) *--p = '-';
+    return p;
+}
+
+// Like printf("%*d", width, v)
+static void writeIntWidth(int v, int width) {
+    char tmp[12];
+    char *p = formatInt(tmp + sizeof tmp, v);
+    for (int len = (int)(tmp + sizeof tmp - p); len < width; len++) writeChar(' ');
+    writeBytes(p, (size_t)(tmp + sizeof tmp - p));
+}
+
+int main(int argc, char *argv[]) {
     int n;
+    int rows = argc > 1 ? atoi(argv[1]) : 10;
 
     printf("Enter a number: ");
     scanf("%d", &n);
 
     printf("\n📋 Multiplication table of %d:\n", n);
     printf("------------------------\n");
-    for (int i = 1; i <= 10; i++) {
-        printf("%2d × %2d = %3d\n", n, i, n * i);
+    for (int i = 1; i <= rows; i++) {
+        writeIntWidth(n, 2);
+        writeBytes(" × ", strlen(" × "));
+        writeIntWidth(i, 2);
+        writeBytes(" = ", 3);
+        writeIntWidth(n * i, 3);
+        writeChar('\n');
     }
+    flushOut();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -2,26 +2,78 @@
  * pyramid_pattern.c
  *
  * Prints a centered pyramid of asterisks.
- * Height = 5.
+ * Height = 5 (or the height given on the command line).
  * Each row: spaces + stars.
+ *
+ * Every row is a slice of one precomputed line: all the spaces the first
+ * row needs followed by all the stars the last row needs. Row r starts r
+ * space-pairs in and takes 2r+1 stars, so it is copied with one memcpy
+ * instead of printing character by character.
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
-int main() {
-    int height = 5;
+// Rows collect in outBuf and go out in one write() when it fills or on
+// flushOut(); a 5-row pyramid is a single system call.
+static char outBuf[1 << 16];
+static size_t outLen;
 
-    for (int row = 0; row < height; row++) {
-        // print leading spaces
-        for (int space = 0; space < height - row - 1; space++) {
-            printf("  ");
-        }
-        // print stars
-        for (int star = 0; star < (2 * row + 1); star++) {
-            printf("* ");
+static void writeAll(const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t w = write(STDOUT_FILENO, p, len);
+        if (w <= 0) return;
+        p += w;
+        len -= (size_t)w;
+    }
+}
+
+// Text printed with printf is still in stdout's own buffer: it goes first
+static void flushOut(void) {
+    fflush(stdout);
+    writeAll(outBuf, outLen);
+    outLen = 0;
+}
+
+static void writeBytes(const char *s, size_t len) {
+    if (len > sizeof outBuf - outLen) {
+        flushOut();
+        if (len > sizeof outBuf) {
+            writeAll(s, len);
+            return;
         }
-        printf("\n");
     }
+    memcpy(outBuf + outLen, s, len);
+    outLen += len;
+}
+
+static void writeChar(char c) {
+    if (outLen == sizeof outBuf) flushOut();
+    outBuf[outLen++] = c;
+}
+
+int main(int argc, char *argv[]) {
+    int height = argc > 1 ? atoi(argv[1]) : 5;
+    if (height <= 0) return 0;
+
+    // "  " x (height-1), then "* " x (2*height-1)
+    size_t spaces = 2 * (size_t)(height - 1), stars = 2 * (2 * (size_t)height - 1);
+    char *line = malloc(spaces + stars);
+    if (!line) return 1;
+    memset(line, ' ', spaces + stars);
+    for (size_t i = spaces; i < spaces + stars; i += 2) line[i] = '*';
+
+    for (int row = 0; row < height; row++) {
+        // skip 'row' space pairs, keep the rest of the spaces and 2*row+1 stars
+        size_t start = 2 * (size_t)row;
+        size_t len = (spaces - start) + 2 * (2 * (size_t)row + 1);
+        writeBytes(line + start, len);
+        writeChar('\n');
+    }
+    flushOut();
 
+    free(line);
     return 0;
-}
\ No newline at end of file
+}
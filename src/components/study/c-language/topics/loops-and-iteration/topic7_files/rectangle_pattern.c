@@ -2,21 +2,69 @@
  * rectangle_pattern.c
  *
  * Prints a solid rectangle of asterisks.
- * Rows = 5, Columns = 3.
+ * Rows = 5, Columns = 3 (or rows and columns from the command line).
+ *
+ * All rows are the same, so the row is built once ("* * * \n") and
+ * copied into the output buffer with memcpy for each row.
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
-int main() {
-    int rows = 5;
-    int cols = 3;
+// Output buffer: the prebuilt row is appended once per row, and the
+// whole rectangle leaves in as few write() calls as outBuf allows.
+static char outBuf[1 << 16];
+static size_t outLen;
 
-    for (int row = 0; row < rows; row++) {
-        for (int col = 0; col < cols; col++) {
-            printf("* ");
+static void writeAll(const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t w = write(STDOUT_FILENO, p, len);
+        if (w <= 0) return;
+        p += w;
+        len -= (size_t)w;
+    }
+}
+
+// Text printed with printf is still in stdout's own buffer: it goes first
+static void flushOut(void) {
+    fflush(stdout);
+    writeAll(outBuf, outLen);
+    outLen = 0;
+}
+
+static void writeBytes(const char *s, size_t len) {
+    if (len > sizeof outBuf - outLen) {
+        flushOut();
+        if (len > sizeof outBuf) {
+            writeAll(s, len);
+            return;
         }
-        printf("\n");  // move to next line after each row
     }
+    memcpy(outBuf + outLen, s, len);
+    outLen += len;
+}
+
+int main(int argc, char *argv[]) {
+    int rows = argc > 1 ? atoi(argv[1]) : 5;
+    int cols = argc > 2 ? atoi(argv[2]) : 3;
+    if (rows <= 0 || cols < 0) return 0;
+
+    size_t len = 2 * (size_t)cols + 1;
+    char *line = malloc(len);
+    if (!line) return 1;
+    for (int col = 0; col < cols; col++) {
+        line[2 * col] = '*';
+        line[2 * col + 1] = ' ';
+    }
+    line[len - 1] = '\n';   // move to next line after each row
+
+    for (int row = 0; row < rows; row++) {
+        writeBytes(line, len);
+    }
+    flushOut();
 
+    free(line);
     return 0;
-}
\ No newline at end of file
+}
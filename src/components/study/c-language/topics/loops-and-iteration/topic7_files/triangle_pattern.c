@@ -2,20 +2,73 @@
  * triangle_pattern.c
  *
  * Prints a right‑angled triangle of asterisks.
- * Height = 5, each row has (row+1) stars.
+ * Height = 5 (or the height given on the command line), each row has
+ * (row+1) stars.
+ *
+ * Row r is the first r+1 "* " pairs of the longest row, so that row is
+ * built once and each line is one memcpy of a prefix of it.
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
-int main() {
-    int height = 5;
+// Each row (a prefix of the longest row, then '\n') is appended to
+// outBuf, which is written out only when full or on flushOut().
+static char outBuf[1 << 16];
+static size_t outLen;
 
-    for (int row = 0; row < height; row++) {
-        for (int col = 0; col <= row; col++) {
-            printf("* ");
+static void writeAll(const char *p, size_t len) {
+    while (len > 0) {
+        ssize_t w = write(STDOUT_FILENO, p, len);
+        if (w <= 0) return;
+        p += w;
+        len -= (size_t)w;
+    }
+}
+
+// Text printed with printf is still in stdout's own buffer: it goes first
+static void flushOut(void) {
+    fflush(stdout);
+    writeAll(outBuf, outLen);
+    outLen = 0;
+}
+
+static void writeBytes(const char *s, size_t len) {
+    if (len > sizeof outBuf - outLen) {
+        flushOut();
+        if (len > sizeof outBuf) {
+            writeAll(s, len);
+            return;
         }
-        printf("\n");
     }
+    memcpy(outBuf + outLen, s, len);
+    outLen += len;
+}
+
+static void writeChar(char c) {
+    if (outLen == sizeof outBuf) flushOut();
+    outBuf[outLen++] = c;
+}
+
+int main(int argc, char *argv[]) {
+    int height = argc > 1 ? atoi(argv[1]) : 5;
+    if (height <= 0) return 0;
+
+    char *line = malloc(2 * (size_t)height);
+    if (!line) return 1;
+    for (int col = 0; col < height; col++) {
+        line[2 * col] = '*';
+        line[2 * col + 1] = ' ';
+    }
+
+    for (int row = 0; row < height; row++) {
+        writeBytes(line, 2 * (size_t)(row + 1));
+        writeChar('\n');
+    }
+    flushOut();
 
+    free(line);
     return 0;
-}
\ No newline at end of file
+}
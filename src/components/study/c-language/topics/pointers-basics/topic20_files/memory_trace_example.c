@@ -1,19 +1,269 @@
+// Build: gcc -O2 -mssse3 memory_trace_example.c   (without -mssse3: plain C path)
+// Usage: ./a.out                         demo below
+//        ./a.out FILE [OFFSET [LENGTH]]  dump part of a file (0x.. accepted)
+//        ./a.out --bench [MB]            per-byte printf vs. hexdump()
+#define _GNU_SOURCE
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
 
-void print_memory(void *ptr, size_t size) {
+// The original: one printf per byte. Kept for comparison.
+void print_memory_printf(FILE *out, void *ptr, size_t size) {
     unsigned char *bytes = (unsigned char*)ptr;
     for (size_t i = 0; i < size; i++) {
-        printf("%02x ", bytes[i]);
-        if ((i+1) % 16 == 0) printf("\n");
+        fprintf(out, "%02x ", bytes[i]);
+        if ((i+1) % 16 == 0) fprintf(out, "\n");
+    }
+    fprintf(out, "\n");
+}
+
+// ---- hexdump engine ----
+// Lines use the classic "hexdump -C" layout:
+// 00000000  48 65 6c 6c 6f 00 00 00  00 00 00 00 00 00 00 00  |Hello...........|
+// and are rendered straight into dumpBuf, which goes out with one write()
+// whenever it fills.
+#define LINE_BYTES 16
+#define LINE_MAX   (16 + 2 + 3 * LINE_BYTES + 1 + 1 + 1 + LINE_BYTES + 2)
+#define LINE_SLACK 16           // vector stores may run past the line end
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+static int dumpFd = STDOUT_FILENO;
+static char dumpBuf[1 << 16];
+static size_t dumpLen;
+
+static void dumpFlush(void) {
+    const char *p = dumpBuf;
+    while (dumpLen > 0) {
+        ssize_t w = write(dumpFd, p, dumpLen);
+        if (w <= 0) break;
+        p += w;
+        dumpLen -= (size_t)w;
+    }
+    dumpLen = 0;
+}
+
+// Room for one more line (plus the vector slack) at the end of dumpBuf
+static char* dumpReserve(void) {
+    if (dumpLen + LINE_MAX + LINE_SLACK > sizeof dumpBuf) dumpFlush();
+    return dumpBuf + dumpLen;
+}
+
+// Offset column, at least 8 digits
+static char* putOffset(char *p, unsigned long long offset, int digits) {
+    for (int i = digits - 1; i >= 0; i--) {
+        p[i] = HEX_DIGITS[offset & 15];
+        offset >>= 4;
+    }
+    return p + digits;
+}
+
+#ifdef __SSSE3__
+// Hex and ASCII columns of a full line, 16 bytes at a time: pshufb looks
+// up all 32 nibbles in the 16-entry digit table at once, two more shuffles
+// per half place the digits among the separating spaces, and the ASCII
+// column is a compare and blend. Writes exactly 69 valid bytes but
+// stores up to LINE_SLACK beyond them.
+static char* putLine16(char *p, const unsigned char *src) {
+    const __m128i digits = _mm_loadu_si128((const __m128i*)HEX_DIGITS);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    __m128i v = _mm_loadu_si128((const __m128i*)src);
+    __m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+    __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(v, nibble));
+    __m128i first = _mm_unpacklo_epi8(hi, lo);      // digits of bytes 0-7
+    __m128i second = _mm_unpackhi_epi8(hi, lo);     // digits of bytes 8-15
+
+    // "xx xx xx xx xx x" and "x xx xx " out of 16 digits; -1 gives a 0 byte
+    // that the OR with the space pattern fills in
+    const __m128i take0 = _mm_setr_epi8(0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1, 10);
+    const __m128i take1 = _mm_setr_epi8(11, -1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i space0 = _mm_setr_epi8(0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0);
+    const __m128i space1 = _mm_setr_epi8(0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, 0, 0, 0, 0, 0, 0);
+    _mm_storeu_si128((__m128i*)p,        _mm_or_si128(_mm_shuffle_epi8(first, take0), space0));
+    _mm_storeu_si128((__m128i*)(p + 16), _mm_or_si128(_mm_shuffle_epi8(first, take1), space1));
+    p[24] = ' ';
+    _mm_storeu_si128((__m128i*)(p + 25), _mm_or_si128(_mm_shuffle_epi8(second, take0), space0));
+    _mm_storeu_si128((__m128i*)(p + 41), _mm_or_si128(_mm_shuffle_epi8(second, take1), space1));
+    p[49] = ' ';
+    p[50] = '|';
+
+    // 0x20..0x7e as themselves, everything else as '.'; bytes >= 0x80 are
+    // negative as signed chars, so both compares reject them
+    __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(0x1f)),
+                                      _mm_cmplt_epi8(v, _mm_set1_epi8(0x7f)));
+    __m128i ascii = _mm_or_si128(_mm_and_si128(printable, v),
+                                 _mm_andnot_si128(printable, _mm_set1_epi8('.')));
+    _mm_storeu_si128((__m128i*)(p + 51), ascii);
+    p[67] = '|';
+    p[68] = '\n';
+    return p + 69;
+}
+#endif
+
+// Hex and ASCII columns for n <= 16 bytes; missing bytes are padded out
+// so the ASCII column of a short last line still lines up.
+static char* putLineScalar(char *p, const unsigned char *src, size_t n) {
+    for (size_t i = 0; i < LINE_BYTES; i++) {
+        if (i == 8) *p++ = ' ';
+        if (i < n) {
+            *p++ = HEX_DIGITS[src[i] >> 4];
+            *p++ = HEX_DIGITS[src[i] & 15];
+        } else {
+            *p++ = ' ';
+            *p++ = ' ';
+        }
+        *p++ = ' ';
+    }
+    *p++ = ' ';
+    *p++ = '|';
+    for (size_t i = 0; i < n; i++) *p++ = (src[i] >= 0x20 && src[i] < 0x7f) ? (char)src[i] : '.';
+    *p++ = '|';
+    *p++ = '\n';
+    return p;
+}
+
+// Dump size bytes at data, numbering offsets from base. With squeeze, a
+// run of lines equal to the one before is printed as a single "*", as
+// hexdump does without -v.
+void hexdump(const void *data, size_t size, unsigned long long base, int squeeze) {
+    const unsigned char *bytes = data;
+    unsigned long long last = base + size;
+    int digits = 8;
+    while (digits < 16 && (last >> (4 * digits)) != 0) digits++;
+    int skipping = 0;
+
+    fflush(stdout);                 // anything printf'd so far comes first
+    for (size_t i = 0; i < size; i += LINE_BYTES) {
+        size_t n = size - i < LINE_BYTES ? size - i : LINE_BYTES;
+        if (squeeze && n == LINE_BYTES && i >= LINE_BYTES &&
+            memcmp(bytes + i, bytes + i - LINE_BYTES, LINE_BYTES) == 0) {
+            if (!skipping) {
+                char *p = dumpReserve();
+                p[0] = '*';
+                p[1] = '\n';
+                dumpLen += 2;
+                skipping = 1;
+            }
+            continue;
+        }
+        skipping = 0;
+        char *start = dumpReserve();
+        char *p = putOffset(start, base + i, digits);
+        *p++ = ' ';
+        *p++ = ' ';
+#ifdef __SSSE3__
+        if (n == LINE_BYTES) p = putLine16(p, bytes + i);
+        else
+#endif
+        p = putLineScalar(p, bytes + i, n);
+        dumpLen += (size_t)(p - start);
+    }
+    char *start = dumpReserve();
+    char *p = putOffset(start, last, digits);
+    *p++ = '\n';
+    dumpLen += (size_t)(p - start);
+    dumpFlush();
+}
+
+// Dump length bytes of a file starting at offset, straight out of an mmap
+// of just that range (length 0: up to the end of the file).
+// Returns 0, or -1 if the file can't be opened or mapped.
+int hexdumpFile(const char *path, unsigned long long offset, unsigned long long length, int squeeze) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0) { close(fd); return -1; }
+    unsigned long long fileSize = (unsigned long long)st.st_size;
+    if (offset > fileSize) offset = fileSize;
+    if (length == 0 || length > fileSize - offset) length = fileSize - offset;
+    if (length == 0) {
+        close(fd);
+        hexdump("", 0, offset, squeeze);
+        return 0;
+    }
+
+    // mmap offsets must be page-aligned: map from the page holding 'offset'
+    unsigned long long page = (unsigned long long)sysconf(_SC_PAGESIZE);
+    unsigned long long mapStart = offset & ~(page - 1);
+    size_t mapLen = (size_t)(offset - mapStart + length);
+    unsigned char *map = mmap(NULL, mapLen, PROT_READ, MAP_PRIVATE, fd, (off_t)mapStart);
+    close(fd);
+    if (map == MAP_FAILED) return -1;
+    madvise(map, mapLen, MADV_SEQUENTIAL);
+    hexdump(map + (offset - mapStart), (size_t)length, offset, squeeze);
+    munmap(map, mapLen);
+    return 0;
+}
+
+void print_memory(void *ptr, size_t size) {
+    hexdump(ptr, size, 0, 1);
+}
+
+static double nowSec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Dump a region of mixed random and zero bytes both ways into /dev/null
+static int runBench(size_t megabytes) {
+    size_t size = megabytes << 20;
+    unsigned char *data = malloc(size);
+    FILE *devNull = fopen("/dev/null", "w");
+    if (!data || !devNull) {
+        fprintf(stderr, "Out of memory!\n");
+        return 1;
+    }
+    unsigned x = 12345;
+    for (size_t i = 0; i < size; i++) {
+        x = x * 1103515245u + 12345u;
+        data[i] = (i >> 16) % 4 == 0 ? 0 : (unsigned char)(x >> 16);   // some zero runs
     }
-    printf("\n");
+
+    double t0 = nowSec();
+    print_memory_printf(devNull, data, size);
+    fflush(devNull);
+    double t1 = nowSec();
+    int savedFd = dumpFd;
+    dumpFd = fileno(devNull);
+    hexdump(data, size, 0, 0);
+    double t2 = nowSec();
+    hexdump(data, size, 0, 1);
+    double t3 = nowSec();
+    dumpFd = savedFd;
+
+    printf("%zu MB: printf per byte %.3f s (%.0f MB/s), hexdump %.3f s (%.0f MB/s), "
+           "with \"*\" squeezing %.3f s\n",
+           megabytes, t1 - t0, megabytes / (t1 - t0), t2 - t1, megabytes / (t2 - t1), t3 - t2);
+    fclose(devNull);
+    free(data);
+    return 0;
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        return runBench(argc > 2 ? strtoull(argv[2], NULL, 0) : 64);
+    }
+    if (argc > 1) {
+        unsigned long long offset = argc > 2 ? strtoull(argv[2], NULL, 0) : 0;
+        unsigned long long length = argc > 3 ? strtoull(argv[3], NULL, 0) : 0;
+        if (hexdumpFile(argv[1], offset, length, 1) != 0) {
+            perror(argv[1]);
+            return 1;
+        }
+        return 0;
+    }
+
     char buffer[10];
     strcpy(buffer, "Hello");
-    printf("Buffer content: ");
+    printf("Buffer content:\n");
     print_memory(buffer, sizeof(buffer));
 
     // Simulate a buffer overflow (for demonstration)
@@ -27,4 +277,4 @@ int main() {
     // printf("After overflow: guard = 0x%x\n", guard);
 
     return 0;
-}
\ No newline at end of file
+}